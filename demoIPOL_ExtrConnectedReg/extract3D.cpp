@@ -33,6 +33,7 @@
 
 #include "DGtal/io/Display3D.h"
 #include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/BrickedVolumeReader.h"
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/Color.h"
 
@@ -52,7 +53,8 @@ static ImaGene::Arguments args;
 
 int main( int argc, char** argv )
 {
-  args.addOption("-image", "-image <filename>  ", "aFile.vol ");
+  args.addOption("-image", "-image <filename> a .vol file or a .bvol file (see BrickedVolumeWriter) ", "aFile.vol ");
+  args.addOption("-roi", "-roi <x0> <y0> <z0> <x1> <y1> <z1>: only extracts the region [x0,x1]x[y0,y1]x[z0,z1] of a .bvol image (only its bricks intersecting the region are decoded).", 6, vector<string>( 6, "0" ) );
   args.addOption("-output", "-output <filename> the output filename with .off extension", "output.off"); 
   args.addOption("-exportSRC", "-exportSRC <filename> export the source set of voxels", "src.off"); 
   args.addOption("-threshold", "-threshold <min> <max> (default: min = 128, max 255  ", "128", "255");
@@ -78,7 +80,34 @@ int main( int argc, char** argv )
   
   typedef ImageSelector < Domain, int>::Type Image;
   typedef IntervalThresholder<Image::Value> Binarizer; 
-  Image image =   VolReader<Image>::importVol(imageFileName);
+  bool bricked = imageFileName.size() > 5
+    && imageFileName.substr( imageFileName.size() - 5 ) == ".bvol";
+  if ( args.check("-roi") && ! bricked )
+    {
+      trace.error() << "extract3D: -roi needs a .bvol image" << endl;
+      return 1;
+    }
+  Point roiLower, roiUpper;
+  if ( args.check("-roi") )
+    {
+      for ( unsigned int i = 0; i < 3; ++i )
+        {
+          roiLower[ i ] = args.getOption("-roi")->getIntValue( i );
+          roiUpper[ i ] = args.getOption("-roi")->getIntValue( i + 3 );
+        }
+      Domain volume = BrickedVolumeReader<Image, unsigned char>( imageFileName ).domain();
+      if ( ! roiLower.isLower( roiUpper )
+           || ! volume.isInside( roiLower ) || ! volume.isInside( roiUpper ) )
+        {
+          trace.error() << "extract3D: -roi needs x0<=x1, y0<=y1, z0<=z1 and a region inside "
+                        << volume << endl;
+          return 1;
+        }
+    }
+  Image image = ! bricked ? VolReader<Image>::importVol(imageFileName)
+    : ! args.check("-roi") ? BrickedVolumeReader<Image, unsigned char>::importBrickedVolume(imageFileName)
+    : BrickedVolumeReader<Image, unsigned char>::importBrickedVolume(imageFileName,
+                                                                     Domain( roiLower, roiUpper ) );
 
   Binarizer b(minThreshold, maxThreshold); 
   PointFunctorPredicate<Image,Binarizer> predicate(image, b); 
@@ -92,15 +121,20 @@ int main( int argc, char** argv )
   K.init(pLower, pUpper, true);
  
   SurfelAdjacency<3> sAdj(  badj );
-  vector<vector<SCell> > vectConnectedSCell;
- 
+  vector<SCell> vectConnectedSCell;
+  vector<size_t> offsets;
  
-  Surfaces<KSpace>::extractAllConnectedSCell(vectConnectedSCell,K, sAdj, predicate, false);
+#ifdef WITH_OPENMP
+  Surfaces<KSpace>::extractAllConnectedSCellParallel(vectConnectedSCell, offsets, K, sAdj, predicate, false);
+#else
+  Surfaces<KSpace>::extractAllConnectedSCell(vectConnectedSCell, offsets, K, sAdj, predicate, false);
+#endif
+  unsigned int nbComponents = offsets.size()-1;
 
   Display3D exportSurfel;
  
   // Each connected compoments are simply displayed with a specific color.
-  GradientColorMap<long> gradient(0, (const long)vectConnectedSCell.size());
+  GradientColorMap<long> gradient(0, (long)nbComponents);
   gradient.addColor(Color::Red);
   gradient.addColor(Color::Yellow);
   gradient.addColor(Color::Green);
@@ -110,13 +144,13 @@ int main( int argc, char** argv )
   gradient.addColor(Color::Red);  
  
   // Processing ViewerInt  
-  for(int i=0; i< vectConnectedSCell.size();i++){
+  for(unsigned int i=0; i< nbComponents;i++){
     DGtal::Color col= gradient(i);
     exportSurfel << CustomColors3D(Color(250, 0,0), Color(col.red(), 
 							  col.green(),
 							  col.blue()));
-    for(int j=0; j< vectConnectedSCell.at(i).size();j++){
-      exportSurfel << vectConnectedSCell.at(i).at(j);
+    for(size_t j=offsets[i]; j< offsets[i+1];j++){
+      exportSurfel << vectConnectedSCell[j];
     }    
   }
 
@@ -33,6 +33,8 @@
 #include "DGtal/geometry/curves/FreemanChain.h"
 #include "DGtal/geometry/helpers/ContourHelper.h"
 #include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/NestedLevelSetsContours.h"
+#include "DGtal/io/writers/BinaryContoursWriter.h"
 
 #include <vector>
 #include <string>
@@ -50,10 +52,12 @@ typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
 
 
 std::vector<unsigned int> getHistoFromImage(const Image &image){
-  const Image::Domain &imgDom = image.domain();
-  std::vector<unsigned int> vectHisto(UCHAR_MAX);
-  for(Image::Domain::ConstIterator it=imgDom.begin(); it!= imgDom.end(); ++it){
-    vectHisto[image(*it)]++;
+  std::vector<unsigned int> vectHisto(UCHAR_MAX+1);
+  for(Image::Size row=0; row < image.nbRows(); row++){
+    const Image::Value *itEnd = image.rowEnd(row);
+    for(const Image::Value *it = image.rowBegin(row); it != itEnd; ++it){
+      vectHisto[*it]++;
+    }
   }
   return vectHisto;
 }
@@ -149,6 +153,43 @@ void saveAllContourAsSDP(std::vector< std::vector< Z2i::Point >  >  vectContours
 }
 
 
+void saveContoursAsBinary(const std::vector< std::vector< Z2i::Point >  > &vectContoursBdryPointels, unsigned int minSize,
+			  bool select, Z2i::Point refPoint, double selectDistanceMax,
+			  BinaryContoursWriter &writer, bool asSDP, bool onlyLargest){
+  // same selection as the text outputs (-selectContour, -outputSDP)
+  std::vector<unsigned int> vectSelected;
+  for(unsigned int k=0; k<vectContoursBdryPointels.size(); k++){
+    if(vectContoursBdryPointels.at(k).size()>minSize){
+      if(select){
+	Z2i::Point ptMean = ContourHelper::getMeanPoint(vectContoursBdryPointels.at(k));
+	unsigned int distance = (unsigned int)ceil(sqrt((double)(ptMean[0]-refPoint[0])*(ptMean[0]-refPoint[0])+
+							(ptMean[1]-refPoint[1])*(ptMean[1]-refPoint[1])));
+	if(distance>selectDistanceMax)
+	  continue;
+      }
+      vectSelected.push_back(k);
+    }
+  }
+  if(onlyLargest && !vectSelected.empty()){
+    unsigned int largest = vectSelected.at(0);
+    for(unsigned int i=1; i<vectSelected.size(); i++){
+      if(vectContoursBdryPointels.at(vectSelected.at(i)).size()>vectContoursBdryPointels.at(largest).size())
+	largest = vectSelected.at(i);
+    }
+    vectSelected.assign(1, largest);
+  }
+  for(unsigned int i=0; i<vectSelected.size(); i++){
+    const std::vector< Z2i::Point > &contour = vectContoursBdryPointels.at(vectSelected.at(i));
+    if(asSDP){
+      writer.addPointContour(contour.begin(), contour.end());
+    }else{
+      FreemanChain<Z2i::Integer> fc (contour);    
+      writer.addFreemanChain(fc);
+    }
+  }
+}
+
+
 void saveSelContoursAsFC(std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels, 
 			 unsigned int minSize, Z2i::Point refPoint, double selectDistanceMax){
   for(unsigned int k=0; k<vectContoursBdryPointels.size(); k++){
@@ -206,6 +247,7 @@ int main( int argc, char** argv )
   args.addBooleanOption("-invertVerticalAxis", "-invertVerticalAxis used to transform the contour representation (need for DGtal), used o nly for the contour displayed, not for the contour selection (-selectContour). ");
   args.addBooleanOption("-outputSDP", "-outputSDP export as a sequence of discrete points instead of freemanchain (use the largest contour if more contours appears)");
   args.addBooleanOption("-outputSDPAll", "-outputSDPAll export as a sequence of discrete points instead of freemanchain (all contours are exported: one per line)");
+  args.addOption("-outputBinary", "-outputBinary <file>: export the contours in the binary contours format (see BinaryContoursWriter) instead of the standard output, as freemanchains or as sequences of discrete points with -outputSDP/-outputSDPAll, with the same selection as the standard output (-selectContour, largest contour with -outputSDP) (the contours of all the thresholds of -thresholdRange are exported in the same file)", "contours.bin");
   args.addBooleanOption("-version", "-version : display version");    
 
  
@@ -246,6 +288,17 @@ int main( int argc, char** argv )
     maxThreshold = args.getOption("-thresholdRange")->getIntValue(2);
   }
  
+  BinaryContoursWriter binaryWriter;
+  bool exportBinary = args.check("-outputBinary");
+  if(exportBinary){
+    std::string binaryFileName = args.getOption("-outputBinary")->getValue(0);
+    if(!binaryWriter.open(binaryFileName, exportSDP || exportSDPALL ? BinaryContoursFormat::POINTS 
+			  : BinaryContoursFormat::FREEMAN_CHAINS)){
+      trace.error() << "Can't open " << binaryFileName << std::endl;
+      return 1;
+    }
+  }
+
   Z2i::Point selectCenter;
   unsigned int selectDistanceMax = 0; 
  
@@ -285,9 +338,17 @@ int main( int argc, char** argv )
     
     SurfelAdjacency<2> sAdj( badj );
     std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
+#ifdef WITH_OPENMP
+    Surfaces<Z2i::KSpace>::extractAllPointContours4CParallel( vectContoursBdryPointels,
+							      ks, predicate, sAdj );  
+#else
     Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
   						      ks, predicate, sAdj );  
-    if(select){
+#endif
+    if(exportBinary){
+      saveContoursAsBinary(vectContoursBdryPointels, minSize, select, selectCenter, selectDistanceMax,
+			   binaryWriter, exportSDP || exportSDPALL, exportSDP && !exportSDPALL);
+    }else if(select){
       if(!exportSDP){
 	saveSelContoursAsFC(vectContoursBdryPointels,  minSize, selectCenter,  selectDistanceMax);
       }else{
@@ -306,19 +367,30 @@ int main( int argc, char** argv )
     }
     trace.info()<< " [done] " << std::endl;
   }else{
+    // All the thresholds [min, min+(i+1)*increment] define nested
+    // sets: their contours are updated from one set to the next one.
+    typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> LevelImage;
+    typedef NestedLevelSetsContours<Z2i::KSpace, LevelImage> LevelSetsContours;
+    std::vector<Image::Value> maxThresholds;
     for(int i=0; minThreshold+(i+1)*increment< maxThreshold; i++){
+      maxThresholds.push_back(minThreshold+(i+1)*increment);
+    }
+    LevelImage levels(image.domain());
+    LevelSetsContours::computeIntervalLevels(levels, image, minThreshold, maxThresholds);
+    SurfelAdjacency<2> sAdj( badj );
+    LevelSetsContours levelSetsContours;
+    levelSetsContours.init(ks, sAdj, levels, maxThresholds.size());
+    while(levelSetsContours.nextLevel()){
       min = minThreshold;
-      max = minThreshold+(i+1)*increment;
-      
-      Binarizer b(min, max); 
-      PointFunctorPredicate<Image,Binarizer> predicate(image, b); 
+      max = maxThresholds[levelSetsContours.level()];
       
       trace.info() << "DGtal contour extraction from thresholds ["<<  min << "," << max << "]" ;
-      SurfelAdjacency<2> sAdj( badj );
       std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
-      Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
-  							ks, predicate, sAdj );  
-      if(select){
+      levelSetsContours.getPointContours( vectContoursBdryPointels );
+      if(exportBinary){
+	saveContoursAsBinary(vectContoursBdryPointels, minSize, select, selectCenter, selectDistanceMax,
+			     binaryWriter, exportSDP || exportSDPALL, exportSDP && !exportSDPALL);
+      }else if(select){
   	if(!exportSDP){
 	  saveSelContoursAsFC(vectContoursBdryPointels,  minSize, selectCenter,  selectDistanceMax);
 	}else{
@@ -334,6 +406,9 @@ int main( int argc, char** argv )
       trace.info() << " [done]" << std::endl;
     }
   }
+  if(exportBinary){
+    binaryWriter.close();
+  }
   return 0;
 }
 
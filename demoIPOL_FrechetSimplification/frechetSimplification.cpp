@@ -41,6 +41,7 @@
 
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
 #include "DGtal/io/boards/Board2D.h"
 
 #include "DGtal/io/boards/CDrawableWithBoard2D.h"
@@ -48,6 +49,9 @@
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/BatchSimplification.h"
+#include "DGtal/geometry/curves/MinimumVertexSimplification.h"
+#include "DGtal/io/readers/BinaryContoursReader.h"
 
 #include "ImaGene/Arguments.h"
 
@@ -63,8 +67,11 @@ static ImaGene::Arguments args;
 
 
 typedef Curve::PointsRange::ConstIterator Iterator;
-typedef FrechetShortcut<Iterator,int> SegmentComputer;
-typedef GreedySegmentation<SegmentComputer> Segmentation;
+typedef FlatFrechetShortcut<Iterator,int> SegmentComputer;
+typedef FrechetShortcut<Iterator,int> ReferenceSegmentComputer;
+typedef std::vector<Z2i::Point>::const_iterator VectorIterator;
+typedef BatchSimplification< FlatFrechetShortcut<VectorIterator,int> > Batch;
+typedef BatchSimplification< FrechetShortcut<VectorIterator,int> > ReferenceBatch;
 
 
 
@@ -86,36 +93,54 @@ void displayContour(const std::vector<Z2i::Point> &contour, Board2D &aBoard){
 
 
 
+template <typename TSegmentComputer>
 void processContour(const std::vector<Z2i::Point> &contour, Board2D & aBoard, double error,ofstream &f,
-		    bool flagWidthOnly, bool displayPolygonInline=true){ 
+		    bool flagWidthOnly, bool displayPolygonInline=true, int optimalWindow=-1){ 
+  typedef TSegmentComputer ShortcutComputer;
+  typedef GreedySegmentation<ShortcutComputer> Segmentation;
+  typedef MinimumVertexSimplification<ShortcutComputer> Simplification;
   Curve aCurve; //grid curve
   aCurve.initFromVector(contour);
   typedef Curve::PointsRange Range; //range
   Range r = aCurve.getPointsRange(); //range
   clock_t time1, time2;
   time1 = clock();
-  Segmentation theSegmentation( r.begin(), r.end(), SegmentComputer(error,flagWidthOnly) );
+  // first and last points of each shortcut
+  std::vector< std::pair<Iterator, Iterator> > vectSeg;
+  if(optimalWindow >= 0){
+    // minimal number of vertices
+    Simplification simplification( r.begin(), r.end(), ShortcutComputer(error,flagWidthOnly), optimalWindow );
+    const std::vector<Iterator> & vertices = simplification.vertices();
+    for (unsigned int i=0; i+1 < vertices.size(); i++){
+      vectSeg.push_back(std::make_pair(vertices.at(i), vertices.at(i+1)));
+    }
+  }else{
+    // the shortcuts are computed while the segmentation is traversed
+    Segmentation theSegmentation( r.begin(), r.end(), ShortcutComputer(error,flagWidthOnly) );
+    typename Segmentation::SegmentComputerIterator it = theSegmentation.begin();
+    typename Segmentation::SegmentComputerIterator itEnd = theSegmentation.end();
+    for ( ; it != itEnd; ++it) {
+      Iterator last = it->end();
+      --last;
+      vectSeg.push_back(std::make_pair(it->begin(), last));
+    }
+  }
   time2 = clock();
   double cpuTime;
   cpuTime =  ((double)time2-(double)time1)/((double)CLOCKS_PER_SEC/1000);
   
-  Segmentation::SegmentComputerIterator it = theSegmentation.begin();
-  Segmentation::SegmentComputerIterator itEnd = theSegmentation.end();
-  
   int simplificationSize=0;
 
   aBoard.setPenColor(Color::Red);
   aBoard.setLineStyle (LibBoard::Shape::SolidStyle );
   
-  std::vector<SegmentComputer> vectSeg;
-  for ( ; it != itEnd; ++it) {
-    SegmentComputer s(*it);
-    vectSeg.push_back(*it);
+  for( unsigned int i=0; i < vectSeg.size(); i++){
+    Z2i::Point p = *(vectSeg.at(i).first);
     //output vertices of the simplification 
     if(displayPolygonInline){
-      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  " " ;
+      f << p[0] << " " << p[1] <<  " " ;
     }else{
-      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  endl;
+      f << p[0] << " " << p[1] <<  endl;
     }
     
   // size of the simpification
@@ -129,12 +154,16 @@ void processContour(const std::vector<Z2i::Point> &contour, Board2D & aBoard, do
   
   aBoard << r;
   
-  for( int i=0; i < vectSeg.size(); i++){
-    aBoard << CustomStyle( vectSeg.at(i).className(),  new CustomPen( Color::Red, Color::Red, 4.0, 
-								      Board2D::Shape::SolidStyle,
-								      Board2D::Shape::RoundCap,
-								      Board2D::Shape::RoundJoin ) );
-    aBoard<< vectSeg.at(i);
+  aBoard.setPenColor(Color::Red);
+  aBoard.setFillColor(Color::Red);
+  aBoard.setLineWidth(4.0);
+  aBoard.setLineStyle(Board2D::Shape::SolidStyle);
+  aBoard.setLineCap(Board2D::Shape::RoundCap);
+  aBoard.setLineJoin(Board2D::Shape::RoundJoin);
+  for( unsigned int i=0; i < vectSeg.size(); i++){
+    Z2i::Point p1 = *(vectSeg.at(i).first);
+    Z2i::Point p2 = *(vectSeg.at(i).second);
+    aBoard.drawLine(p1[0], p1[1], p2[0], p2[1]);
   }
 }
 
@@ -142,6 +171,89 @@ void processContour(const std::vector<Z2i::Point> &contour, Board2D & aBoard, do
 
 
 
+/**
+ * Writes the vertices of the simplification of a contour on a line
+ * and draws the contour, its grid curve and its simplification.
+ */
+template <typename TBatch>
+void outputContour(const TBatch & batch, unsigned int i, const std::vector<Z2i::Point> &contour,
+                   const Curve &aCurve, Board2D & aBoard, double error, ofstream &f){
+  const typename TBatch::ContourStatistics & stats = batch.statistics()[i];
+  std::vector<Z2i::Point> polygon;
+  batch.getVertices(i, polygon);
+  for( unsigned int j=0; j < polygon.size(); j++){
+    f << polygon.at(j)[0] << " " << polygon.at(j)[1] <<  " " ;
+  }
+  f << endl;
+  std::cout << stats.nbPoints << " " << error << " " << stats.nbVertices << " " << stats.cpuTime
+            << " " << stats.maxDistance << std::endl;
+
+  displayContour(contour, aBoard);
+  Curve::PointsRange r = aCurve.getPointsRange();
+  aBoard << r;
+  if(polygon.empty())
+    return;
+  // the last shortcut ends at the last point of the grid curve
+  polygon.push_back(*(r.rbegin()));
+  aBoard.setPenColor(Color::Red);
+  aBoard.setFillColor(Color::Red);
+  aBoard.setLineWidth(4.0);
+  aBoard.setLineStyle(Board2D::Shape::SolidStyle);
+  aBoard.setLineCap(Board2D::Shape::RoundCap);
+  aBoard.setLineJoin(Board2D::Shape::RoundJoin);
+  for( unsigned int j=0; j+1 < polygon.size(); j++){
+    aBoard.drawLine(polygon.at(j)[0], polygon.at(j)[1], polygon.at(j+1)[0], polygon.at(j+1)[1]);
+  }
+}
+
+
+/**
+ * Simplifies all the contours with a BatchSimplification (in
+ * parallel with OpenMP), then writes and draws them. As for a single
+ * contour, each contour is first converted into a grid curve
+ * (ConnectivityException if it is not 4-connected) and the points of
+ * the grid curve are simplified.
+ */
+template <typename TBatch>
+void processContours(const std::vector< std::vector<Z2i::Point> > &contours, Board2D & aBoard, 
+                     double error, ofstream &f, bool flagWidthOnly){
+  typedef typename TBatch::SegmentComputer BatchSegmentComputer;
+  std::vector<Curve> curves(contours.size());
+  std::vector< std::vector<Z2i::Point> > curvePoints(contours.size());
+  for (unsigned int j=0; j<contours.size(); j++){
+    curves.at(j).initFromVector(contours.at(j));
+    Curve::PointsRange r = curves.at(j).getPointsRange();
+    curvePoints.at(j).assign(r.begin(), r.end());
+  }
+  TBatch batch(BatchSegmentComputer(error, flagWidthOnly));
+  clock_t time1 = clock();
+  batch.simplify(curvePoints);
+  clock_t time2 = clock();
+  std::cout << "# curve_size error simplification_size cpu_time max_distance" << std::endl;
+  for (unsigned int j=0; j<contours.size(); j++){
+    outputContour(batch, j, contours.at(j), curves.at(j), aBoard, error, f);
+  }
+  trace.info() << "total cpu_time " << ((double)time2-(double)time1)/((double)CLOCKS_PER_SEC/1000) << std::endl;
+}
+
+
+/**
+ * Simplifies all the contours of a binary contours file.
+ */
+template <typename TBatch>
+void processContours(const BinaryContoursReader<Z2i::Point> &reader, Board2D & aBoard, 
+                     double error, ofstream &f, bool flagWidthOnly){
+  std::vector< std::vector<Z2i::Point> > contours(reader.size());
+  for (unsigned int j=0; j<reader.size(); j++){
+    reader.getPoints(j, contours.at(j));
+  }
+  processContours<TBatch>(contours, aBoard, error, f, flagWidthOnly);
+}
+
+
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -150,7 +262,10 @@ int main( int argc, char** argv )
   args.addOption( "-error", "-error <val>:parameter used in the simplification algorithm (Frechet or width) (default is 2)", "2" );
   args.addOption("-sdp", "-sdp <contour.sdp> : Import a contour as a Sequence of Discrete Points (SDP format)", "contour.sdp" );
   args.addOption( "-imageSize", "-imageSize <width> <height>: used to improve the output display to correspond to an source image by displaying an empty box of width 0 (to force the correspondance of the BB)", "", "" );
+  args.addOption("-bin", "-bin <contours.bin> : Import all the contours of a file in the binary contours format (see BinaryContoursWriter), given as freemanchains or as sequences of discrete points", "contours.bin" );
   args.addBooleanOption("-w", "-w: compute the simplification using the width only");
+  args.addBooleanOption("-reference", "-reference: compute the shortcuts with the reference FrechetShortcut implementation (slower)");
+  args.addOption("-optimal", "-optimal <window>: compute a simplification with a minimal number of vertices instead of the greedy one, the shortcuts having at most <window> points (0 for no limit, only for a single contour)", "0");
   args.addBooleanOption("-allContours", "-allContours: compute the simplification of all the contours (one contour per line given in sdp file)");
   
   bool parseOK=  args.readArguments( argc, argv );
@@ -172,6 +287,11 @@ int main( int argc, char** argv )
   bool flagWidthOnly = false;
   if(args.check("-w"))
     flagWidthOnly = true;
+  int optimalWindow = -1;
+  if(args.check("-optimal"))
+    optimalWindow = args.getOption("-optimal")->getIntValue(0);
+  void (*process)(const std::vector<Z2i::Point> &, Board2D &, double, ofstream &, bool, bool, int) =
+    args.check("-reference") ? processContour<ReferenceSegmentComputer> : processContour<SegmentComputer>;
 
 
   if( args.check("-sdp") && !args.check("-allContours")){
@@ -179,7 +299,7 @@ int main( int argc, char** argv )
     string fileName = args.getOption("-sdp")->getValue(0);
     contour =   PointListReader< Z2i::Point >::getPointsFromFile(fileName); 
     std::cout << "# curve_size error simplification_size cpu_time  "<< std::endl;
-    processContour(contour, board, error, f, flagWidthOnly, false);     
+    process(contour, board, error, f, flagWidthOnly, false, optimalWindow);     
     board.saveEPS("output.eps", 800, 800 ); 
   }
 
@@ -187,20 +307,30 @@ int main( int argc, char** argv )
   if( args.check("-sdp") && args.check("-allContours")  ){
     string fileName = args.getOption("-sdp")->getValue(0);
     std::vector< std::vector<Z2i::Point> > vectContours =   PointListReader< Z2i::Point >::getPolygonsFromFile(fileName);
-    std::cout << "# curve_size error simplification_size cpu_time  " << std::endl;
-    for (int j=0; j<vectContours.size(); j++){
-      trace.info() << "# Processing contour " << j << endl;
-      processContour(vectContours.at(j), board, error,  f, flagWidthOnly, true); 
-    }    
-
-      if(args.check("-imageSize")){
-    unsigned int width = args.getOption("-imageSize")->getIntValue(0);
-    unsigned int height = args.getOption("-imageSize")->getIntValue(1);
-    board.setLineWidth(0.0);
-    board.setFillColor( DGtal::Color::None);
-    board.drawRectangle(0,height, width, height);
+    if(args.check("-reference"))
+      processContours<ReferenceBatch>(vectContours, board, error, f, flagWidthOnly);
+    else
+      processContours<Batch>(vectContours, board, error, f, flagWidthOnly);
+
+    if(args.check("-imageSize")){
+      unsigned int width = args.getOption("-imageSize")->getIntValue(0);
+      unsigned int height = args.getOption("-imageSize")->getIntValue(1);
+      board.setLineWidth(0.0);
+      board.setFillColor( DGtal::Color::None);
+      board.drawRectangle(0,height, width, height);
+    }
+
+    board.saveEPS("output.eps", 800, 800); 
   }
 
+
+  if( args.check("-bin") ){
+    string fileName = args.getOption("-bin")->getValue(0);
+    BinaryContoursReader<Z2i::Point> reader(fileName);
+    if(args.check("-reference"))
+      processContours<ReferenceBatch>(reader, board, error, f, flagWidthOnly);
+    else
+      processContours<Batch>(reader, board, error, f, flagWidthOnly);
     board.saveEPS("output.eps", 800, 800); 
   }
 
@@ -29,7 +29,6 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
-#include <queue>
 #include <QImageReader>
 #include <QtGui/qapplication.h>
 #include "DGtal/io/viewers/Viewer3D.h"
@@ -37,6 +36,7 @@
 #include "DGtal/io/Color.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/HomotopicThinning.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -76,33 +76,15 @@ int main( int argc, char** argv )
   trace.warning() << "  [Done]";
   
 
-  Object6_26 shape( dt6_26, shape_set );
-  int nb_simple=0; 
-  int layer = 0;
-  do 
-    {
-      DigitalSet & S = shape.pointSet();
-      std::queue<DigitalSet::Iterator> Q;
-      for ( DigitalSet::Iterator it = S.begin(); it != S.end(); ++it )
-  if ( shape.isSimple( *it ) )
-    Q.push( it );
-      nb_simple = 0;
-      while ( ! Q.empty() )
-  {
-    DigitalSet::Iterator it = Q.front();
-    Q.pop();
-    if ( shape.isSimple( *it ) )
-      {
-        cerr << "point simple " << (*it) << endl; 
-        S.erase( *it );
-        ++nb_simple;
-      }
-  }
-      ++layer;
-    }
-  while ( nb_simple != 0 );
-
-  DigitalSet & S = shape.pointSet();
+  // Removal of the simple points, the independent ones being
+  // processed in parallel.
+  trace.beginBlock ( "Homotopic thinning" );
+  HomotopicThinning<DT6_26> thinning( dt6_26 );
+  DigitalSet S( shape_set );
+  thinning.thin( S );
+  trace.info() << thinning << " " << shape_set.size() << " -> "
+               << S.size() << " points" << std::endl;
+  trace.endBlock();
 
   // Display by using two different list to manage OpenGL transparency.
 
@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchSimplification.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BatchSimplification.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchSimplification_RECURSES)
+#error Recursive header files inclusion detected in BatchSimplification.h
+#else // defined(BatchSimplification_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchSimplification_RECURSES
+
+#if !defined BatchSimplification_h
+/** Prevents repeated inclusion of headers. */
+#define BatchSimplification_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchSimplification
+  /**
+   * Description of template class 'BatchSimplification' <p>
+   * \brief Aim: Simplifies many contours at once, each contour being
+   * replaced by the first points of the segments of its greedy
+   * segmentation (see GreedySegmentation), as in the
+   * frechetSimplification demo.
+   *
+   * The contours are given as a vector of point sequences, as a
+   * flat vector of points with the offsets of the contours, or as any
+   * reader of contours with the methods size(), nbElements(i) and
+   * getPoints(i, points), like BinaryContoursReader. They are
+   * simplified in parallel if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true"): the contours are
+   * dispatched to the threads by dynamic scheduling, the largest
+   * first, and each thread stores its vertices in its own buffer.
+   * The vertices are then copied in a single vector, in the order of
+   * the contours, and the vertices of the i-th contour are the range
+   * [offsets()[i], offsets()[i+1]) of vertices().
+   *
+   * The points of a contour are segmented as they are given: unlike
+   * GridCurve::initFromVector, neither the connectivity nor a repeated
+   * closing point is checked. To get the simplification of the demo,
+   * give the points of GridCurve::getPointsRange().
+   *
+   * For each contour, the number of points, the number of vertices
+   * and the maximal distance between a point and the segment of its
+   * shortcut are also given. The buffers are kept from a call to the
+   * next one.
+   *
+   * @code
+   * typedef FlatFrechetShortcut<std::vector<Z2i::Point>::const_iterator, int> SegmentComputer;
+   * BatchSimplification<SegmentComputer> batch( SegmentComputer( 2.0 ) );
+   * batch.simplify( contours );
+   * for ( unsigned int i = 0; i < contours.size(); ++i )
+   *   trace.info() << batch.statistics()[ i ].nbVertices << " vertices, error "
+   *                << batch.statistics()[ i ].maxDistance << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer a model of CForwardSegmentComputer on
+   * the const iterators of a std::vector of points, e.g.
+   * FlatFrechetShortcut or FrechetShortcut.
+   *
+   * @see GreedySegmentation, FlatFrechetShortcut, testBatchSimplification.cpp
+   */
+  template <typename TSegmentComputer>
+  class BatchSimplification
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( CForwardSegmentComputer<TSegmentComputer> ));
+
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point;
+    typedef std::vector<Point> Contour;
+    typedef std::size_t Size;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< ConstIterator,
+                          typename Contour::const_iterator >::value ));
+
+    /**
+     * Statistics of the simplification of a contour.
+     */
+    struct ContourStatistics
+    {
+      /// Number of points of the contour
+      Size nbPoints;
+      /// Number of vertices of the simplification
+      Size nbVertices;
+      /// Maximal distance between a point and the segment of its shortcut
+      double maxDistance;
+      /// Time spent on the simplification of the contour (in ms)
+      double cpuTime;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aSegmentComputer the segment computer copied for each
+     * contour (with its parameters, e.g. the error).
+     */
+    BatchSimplification( const SegmentComputer & aSegmentComputer );
+
+    /**
+     * Simplifies a set of contours.
+     * @param contours the contours.
+     */
+    void simplify( const std::vector<Contour> & contours );
+
+    /**
+     * Simplifies a set of contours stored in a single vector.
+     * @param points the points of all the contours.
+     * @param offsets the contour i is [offsets[i], offsets[i+1]).
+     */
+    void simplify( const Contour & points, const std::vector<Size> & offsets );
+
+    /**
+     * Simplifies the contours of a reader, e.g. a
+     * BinaryContoursReader. The points of a contour are copied in a
+     * buffer of its thread before its simplification.
+     * @tparam ContourReader a type with the methods size(),
+     * nbElements(i) and getPoints(i, points).
+     * @param reader the reader.
+     */
+    template <typename ContourReader>
+    void simplifyAll( const ContourReader & reader );
+
+    /**
+     * @return the number of contours of the last simplification.
+     */
+    Size nbContours() const;
+
+    /**
+     * @return the vertices of all the simplified contours.
+     */
+    const Contour & vertices() const;
+
+    /**
+     * @return the offsets of the simplified contours in vertices()
+     * (nbContours() + 1 values).
+     */
+    const std::vector<Size> & offsets() const;
+
+    /**
+     * @return the statistics of the contours.
+     */
+    const std::vector<ContourStatistics> & statistics() const;
+
+    /**
+     * Copies the vertices of a simplified contour.
+     * @param i the index of a contour.
+     * @param aPolygon (returns) its vertices.
+     */
+    void getVertices( Size i, Contour & aPolygon ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The segment computer copied for each contour.
+    SegmentComputer mySegmentComputer;
+    /// The vertices of all the contours.
+    Contour myVertices;
+    /// The offsets of the contours in myVertices.
+    std::vector<Size> myOffsets;
+    /// The statistics of the contours.
+    std::vector<ContourStatistics> myStatistics;
+    /// The vertices computed by each thread.
+    std::vector<Contour> myThreadVertices;
+    /// For each contour, its thread and its offset in the buffer of the thread.
+    std::vector< std::pair<int, Size> > myPlaces;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Contours of a vector of contours.
+     */
+    struct VectorSource
+    {
+      const std::vector<Contour> & myContours;
+      VectorSource( const std::vector<Contour> & contours ) : myContours( contours ) {}
+      Size size() const { return myContours.size(); }
+      Size weight( Size i ) const { return myContours[ i ].size(); }
+      void get( Size i, Contour & /*buffer*/, ConstIterator & itb, ConstIterator & ite ) const
+      {
+        itb = myContours[ i ].begin();
+        ite = myContours[ i ].end();
+      }
+    };
+
+    /**
+     * Contours of a flat vector of points.
+     */
+    struct FlatSource
+    {
+      const Contour & myPoints;
+      const std::vector<Size> & myOffsets;
+      FlatSource( const Contour & points, const std::vector<Size> & offsets )
+        : myPoints( points ), myOffsets( offsets ) {}
+      Size size() const { return myOffsets.empty() ? 0 : myOffsets.size() - 1; }
+      Size weight( Size i ) const { return myOffsets[ i+1 ] - myOffsets[ i ]; }
+      void get( Size i, Contour & /*buffer*/, ConstIterator & itb, ConstIterator & ite ) const
+      {
+        itb = myPoints.begin() + myOffsets[ i ];
+        ite = myPoints.begin() + myOffsets[ i+1 ];
+      }
+    };
+
+    /**
+     * Contours of a reader.
+     */
+    template <typename ContourReader>
+    struct ReaderSource
+    {
+      const ContourReader & myReader;
+      ReaderSource( const ContourReader & reader ) : myReader( reader ) {}
+      Size size() const { return myReader.size(); }
+      Size weight( Size i ) const { return myReader.nbElements( i ); }
+      void get( Size i, Contour & buffer, ConstIterator & itb, ConstIterator & ite ) const
+      {
+        myReader.getPoints( i, buffer );
+        itb = buffer.begin();
+        ite = buffer.end();
+      }
+    };
+
+    /**
+     * Simplifies all the contours of a source.
+     * @param source a VectorSource, a FlatSource or a ReaderSource.
+     */
+    template <typename Source>
+    void run( const Source & source );
+
+    /**
+     * Simplifies a contour.
+     * @param itb begin of the contour.
+     * @param ite end of the contour.
+     * @param out (returns) the vertices are added at the end.
+     * @param stats (returns) the statistics of the contour.
+     */
+    void simplifyContour( const ConstIterator & itb, const ConstIterator & ite,
+                          Contour & out, ContourStatistics & stats ) const;
+
+    /**
+     * @return the distance between [p] and the segment [a,b].
+     */
+    static double distanceToSegment( const Point & p, const Point & a, const Point & b );
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * Forbidden by default.
+     */
+    BatchSimplification();
+
+  }; // end of class BatchSimplification
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchSimplification'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchSimplification' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchSimplification<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/BatchSimplification.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchSimplification_h
+
+#undef BatchSimplification_RECURSES
+#endif // else defined(BatchSimplification_RECURSES)
@@ -0,0 +1,446 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatFrechetShortcut.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module FlatFrechetShortcut.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatFrechetShortcut_RECURSES)
+#error Recursive header files inclusion detected in FlatFrechetShortcut.h
+#else // defined(FlatFrechetShortcut_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatFrechetShortcut_RECURSES
+
+#if !defined FlatFrechetShortcut_h
+/** Prevents repeated inclusion of headers. */
+#define FlatFrechetShortcut_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatFrechetShortcut
+  /**
+   * Description of template class 'FlatFrechetShortcut' <p>
+   * \brief Aim: On-line computation of the longest shortcut according
+   * to the Fréchet distance for a given error, with the same test as
+   * FrechetShortcut but a cheaper representation of its state.
+   *
+   * As in FrechetShortcut, a point can be added if it belongs to the
+   * cone of the directions whose width is lower than the error
+   * (width test) and if no backpath longer than the error exists in
+   * its direction (backpath test). Only the data structures differ:
+   *
+   * - the occulters of each octant are stored by value, sorted along
+   *   the curve, in a flat vector. The sector of an occulter is bounded
+   *   by two integer directions so that the update of the occulters is
+   *   exact. The forbidden directions of an octant are a flat sorted
+   *   vector of disjoint intervals of tan(angle) in [0,1]. These
+   *   vectors are cleared but not released by init(), so that a
+   *   segmentation reuses them for all its segments.
+   *
+   * - the cone of the width test is bounded by two direction vectors,
+   *   which are compared with cross products instead of angles.
+   *
+   * - the points are read once per extension: the first and last
+   *   points of the shortcut are cached. The shortcuts can thus also
+   *   be computed from points given one by one, with init(const Point &)
+   *   and extendForward(const Point &) (see StreamingFrechetSimplification).
+   *
+   * This class is a model of the concept CForwardSegmentComputer and
+   * can replace FrechetShortcut, e.g. in GreedySegmentation:
+   *
+   * @code
+   * typedef FlatFrechetShortcut<Curve::PointsRange::ConstIterator, int> SegmentComputer;
+   * GreedySegmentation<SegmentComputer> segmentation( r.begin(), r.end(), SegmentComputer( error ) );
+   * @endcode
+   *
+   * @tparam TIterator Iterator type on 2D digital points.
+   * @tparam TInteger type of integer, model of CInteger.
+   *
+   * @see FrechetShortcut, testFlatFrechetShortcut.cpp
+   */
+  template <typename TIterator,
+            typename TInteger = typename IteratorCirculatorTraits<TIterator>::Value::Coordinate>
+  class FlatFrechetShortcut
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( CInteger<TInteger> ));
+    typedef TInteger Integer;
+
+    typedef TIterator ConstIterator;
+    typedef FlatFrechetShortcut<ConstIterator, Integer> Self;
+    typedef FlatFrechetShortcut<std::reverse_iterator<ConstIterator>, Integer> Reverse;
+
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Vector;
+    typedef typename Vector::Coordinate Coordinate;
+    typedef PointVector<2, double> RealVector;
+
+    /**
+     * An occulter of an octant: a point which hides the next points
+     * of the curve for the directions of the sector [angleMin,angleMax]
+     * of the octant.
+     */
+    struct Occulter
+    {
+      Point point;
+      Vector angleMin;
+      Vector angleMax;
+    };
+
+    /// A closed interval of tan(angle) in [0,1].
+    typedef std::pair<double, double> Interval;
+
+    /**
+     * The occulters and the forbidden directions of one octant.
+     */
+    class Backpath
+    {
+    public:
+      /**
+       * Constructor.
+       * @param q the octant.
+       */
+      Backpath( int q = 0 );
+
+      /**
+       * Forgets all the occulters and forbidden directions.
+       */
+      void reset();
+
+      /**
+       * Updates the backpath with a new point of the curve.
+       * @param d the chain code of the step, in the frame of the octant.
+       * @param prevP the previous point.
+       * @param p the new point.
+       * @param radius the radius of the error disks.
+       */
+      void update( int d, const Point & prevP, const Point & p, double radius );
+
+      /**
+       * @param v a non null vector of the octant.
+       * @return 'true' if the direction of v is forbidden.
+       */
+      bool isForbidden( const Vector & v ) const;
+
+    private:
+      /// The octant.
+      int myQuad;
+      /// True when the last points were a backpath in the octant.
+      bool myFlag;
+      /// The occulters, sorted along the curve.
+      std::vector<Occulter> myOcculters;
+      /// The forbidden directions, sorted disjoint intervals.
+      std::vector<Interval> myForbiddenIntervals;
+
+      /**
+       * Updates the occulters when a backpath begins at [p].
+       */
+      void updateOcculters( const Point & p );
+
+      /**
+       * Adds the directions forbidden by the backpaths ending at [p].
+       */
+      void updateIntervals( const Point & p, double radius );
+
+      /**
+       * Inserts [lo,hi] in myForbiddenIntervals.
+       */
+      void addInterval( double lo, double hi );
+    };
+
+    /**
+     * A cone of directions: the whole plane or the directions between
+     * myMin and myMax, counterclockwise.
+     */
+    struct Cone
+    {
+      bool myInf;
+      RealVector myMin;
+      RealVector myMax;
+
+      /**
+       * Constructor of the infinite cone.
+       */
+      Cone();
+
+      /**
+       * Constructor. The directions are ordered so that the cone is
+       * lower than PI.
+       * @param a a direction.
+       * @param b another direction.
+       */
+      Cone( const RealVector & a, const RealVector & b );
+
+      /**
+       * @return 'true' if the cone is empty.
+       */
+      bool isEmpty() const;
+
+      /**
+       * @param v a direction.
+       * @return 'true' if v is between myMin and myMax.
+       */
+      bool contains( const RealVector & v ) const;
+
+      /**
+       * Intersects the cone with [c] or, if they are disjoint, with
+       * the symmetrical of [c].
+       * @param c a finite cone.
+       */
+      void intersectCones( const Cone & c );
+
+      /**
+       * @param c a finite cone.
+       * @return the intersection of the cone with [c].
+       */
+      Cone intersectConesSimple( const Cone & c ) const;
+    };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * @param p a point.
+     * @param q the next point (8-neighbour of p).
+     * @return the chain code of the step pq.
+     */
+    static int computeChainCode( const Point & p, const Point & q );
+
+    /**
+     * @param p a point.
+     * @param q another point.
+     * @return the octant of the direction pq.
+     */
+    static int computeQuadrant( const Point & p, const Point & q );
+
+    /**
+     * @param d a chain code.
+     * @return the corresponding vector.
+     */
+    static Vector chainCode2Vect( int d );
+
+    /**
+     * @return the dot product of [u] and [v].
+     */
+    static Integer dotProduct( const Vector & u, const Vector & v );
+
+    /**
+     * @return the cross product of [u] and [v].
+     */
+    static Integer crossProduct( const Vector & u, const Vector & v );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor.
+     * not valid
+     */
+    FlatFrechetShortcut();
+
+    /**
+     * Constructor.
+     * @param error the maximal Fréchet distance.
+     * @param flagWidthOnly if 'true', only the width is tested.
+     */
+    FlatFrechetShortcut( double error, bool flagWidthOnly = false );
+
+    /**
+     * Initialisation.
+     * @param it an iterator on a sequence of points
+     */
+    void init( const ConstIterator & it );
+
+    /**
+     * @return a new segment computer with the same parameters.
+     */
+    Self getSelf() const;
+
+    /**
+     * @return a new segment computer working on reverse iterators.
+     */
+    Reverse getReverse() const;
+
+    /**
+     * Equality operator.
+     * @param other the object to compare with.
+     * @return 'true' if both objects have the same range and parameters.
+     */
+    bool operator==( const Self & other ) const;
+
+    /**
+     * Difference operator.
+     * @param other the object to compare with.
+     * @return 'false' if equal, 'true' otherwise.
+     */
+    bool operator!=( const Self & other ) const;
+
+    /**
+     * Tests whether the current shortcut can be extended, without
+     * modifying it.
+     * @return 'true' if yes, 'false' otherwise.
+     */
+    bool isExtendableForward() const;
+
+    /**
+     * Tries to add the next point. The cone and the backpaths are
+     * updated even if the point is not added.
+     * @return 'true' if the point was added, 'false' otherwise.
+     */
+    bool extendForward();
+
+    /**
+     * Initialisation from a point. Together with
+     * extendForward(const Point &), computes the shortcuts of a
+     * stream of points: the iterators are neither read nor updated.
+     * @param p the first point.
+     */
+    void init( const Point & p );
+
+    /**
+     * Tries to add the point [newP] after the last point, as
+     * extendForward() does with the point following end()-1.
+     * @param newP the new point.
+     * @return 'true' if the point was added, 'false' otherwise.
+     */
+    bool extendForward( const Point & newP );
+
+    /**
+     * @return begin iterator of the shortcut.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return end iterator of the shortcut.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the error.
+     */
+    double error() const;
+
+    /**
+     * @return the name of the class.
+     */
+    std::string className() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The maximal Fréchet distance.
+    double myError;
+    /// The radius of the error disks, as computed by FrechetShortcut.
+    double myRadius;
+    /// If 'true', the backpaths are not tested.
+    bool myFlagWidthOnly;
+    /// The backpaths, one per octant.
+    Backpath myBackpath[ 8 ];
+    /// The cone of the width test.
+    Cone myCone;
+    /// Begin of the shortcut.
+    ConstIterator myBegin;
+    /// Last point of the shortcut.
+    ConstIterator myEnd;
+    /// Copy of *myBegin.
+    Point myFirstP;
+    /// Copy of *myEnd.
+    Point myLastP;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Updates the cone with the new point and tests its direction.
+     * @param newP the new point.
+     * @return 'true' if the width test succeeds.
+     */
+    bool updateWidth( const Point & newP );
+
+    /**
+     * Updates the backpaths with the new point and tests its direction.
+     * @param newP the new point.
+     * @return 'true' if the backpath test succeeds.
+     */
+    bool updateBackpath( const Point & newP );
+
+  }; // end of class FlatFrechetShortcut
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatFrechetShortcut'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatFrechetShortcut' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatFrechetShortcut<TIterator, TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/FlatFrechetShortcut.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatFrechetShortcut_h
+
+#undef FlatFrechetShortcut_RECURSES
+#endif // else defined(FlatFrechetShortcut_RECURSES)
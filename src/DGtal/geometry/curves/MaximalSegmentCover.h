@@ -0,0 +1,346 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MaximalSegmentCover.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module MaximalSegmentCover.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MaximalSegmentCover_RECURSES)
+#error Recursive header files inclusion detected in MaximalSegmentCover.h
+#else // defined(MaximalSegmentCover_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MaximalSegmentCover_RECURSES
+
+#if !defined MaximalSegmentCover_h
+/** Prevents repeated inclusion of headers. */
+#define MaximalSegmentCover_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MaximalSegmentCover
+  /**
+   * Description of template class 'MaximalSegmentCover' <p>
+   * \brief Aim: Stores the whole set of maximal segments of a closed
+   * digital curve given by a Freeman chain, and updates it after a
+   * local edit of the chain without recomputing the maximal segments
+   * far from the edit.
+   *
+   * The points of the curve are stored in a vector, and each maximal
+   * segment is stored as an extent: the index of its first point and
+   * its number of points. The segments are sorted by their first
+   * point, and are recognized again on demand by segment(). The
+   * segment computer works on circulators on the vector, as the
+   * segmentations of closed curves (see SaturatedSegmentation).
+   *
+   * An edit, splice(first, last, codes), replaces the codes
+   * [first,last) of the chain by other codes with the same
+   * displacement, so that the curve stays closed. A maximal segment
+   * is still a maximal segment of the new curve if its points and the
+   * points just before and after it are neither removed nor separated
+   * by the edit. These segments are kept (their indices being
+   * shifted), and the other ones are replaced by the maximal segments
+   * following the last kept segment before the edit (see
+   * nextMaximalSegment()) until the first kept segment after the edit.
+   * Only these segments are recognized: the time of the recognition
+   * depends on the size of the edit and on the length of the maximal
+   * segments around it, not on the length of the curve (the points and
+   * the extents are shifted in linear time, without any
+   * recognition).
+   *
+   * eval() gives the estimations of a segment computer estimator (see
+   * CSegmentComputerEstimator) from the most centered maximal segments,
+   * with the same rule as MostCenteredMaximalSegmentEstimator, and
+   * changedBegin() and nbChanged() give the points for which they may
+   * have changed after the last edit.
+   *
+   * @code
+   * typedef std::vector<Z2i::Point>::const_iterator Iterator;
+   * typedef ArithmeticalDSS<Circulator<Iterator>, int, 4> SegmentComputer;
+   * MaximalSegmentCover<SegmentComputer> cover;
+   * cover.init( chain );
+   * cover.splice( 10, 13, "01011" );
+   * trace.info() << cover.size() << " maximal segments, "
+   *              << cover.nbRecomputed() << " recognized" << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer a model of CForwardSegmentComputer on
+   * circulators on a vector of points, e.g. ArithmeticalDSS.
+   *
+   * @see SaturatedSegmentation, IncrementalMostCenteredMaximalSegmentEstimator,
+   * testMaximalSegmentCover.cpp
+   */
+  template <typename TSegmentComputer>
+  class MaximalSegmentCover
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( CForwardSegmentComputer<TSegmentComputer> ));
+
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point;
+    typedef typename Point::Coordinate Integer;
+    typedef FreemanChain<Integer> FreemanChainType;
+    typedef std::vector<Point> Range;
+    typedef std::size_t Index;
+    typedef std::size_t Size;
+    /// Index of the first point and number of points of a segment.
+    typedef std::pair<Index, Size> Extent;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< ConstIterator,
+                          Circulator<typename Range::const_iterator> >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The cover is empty until init() is called.
+     * @param aSegmentComputer the segment computer.
+     */
+    MaximalSegmentCover( const SegmentComputer & aSegmentComputer = SegmentComputer() );
+
+    /**
+     * Computes the maximal segments of a closed curve.
+     * @param aChain a closed Freeman chain.
+     * @throw InputException if the chain is not closed.
+     */
+    void init( const FreemanChainType & aChain );
+
+    /**
+     * Replaces the codes [first,last) of the chain by @a codes and
+     * updates the maximal segments. The points before @a first keep
+     * their indices.
+     * @param first index of the first replaced code.
+     * @param last index after the last replaced code (at most the
+     * number of codes).
+     * @param codes the new codes, with the same displacement as the
+     * replaced ones.
+     * @throw InputException if the range or the codes are not valid
+     * (the cover is then unchanged).
+     */
+    void splice( const Index first, const Index last, const std::string & codes );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return the number of maximal segments.
+     */
+    Size size() const;
+
+    /**
+     * @return the number of points (and codes) of the curve.
+     */
+    Size nbPoints() const;
+
+    /**
+     * @return the points of the curve.
+     */
+    const Range & points() const;
+
+    /**
+     * @return the codes of the chain.
+     */
+    const std::string & codes() const;
+
+    /**
+     * @return the Freeman chain of the curve.
+     */
+    FreemanChainType chain() const;
+
+    /**
+     * @return the extents of the maximal segments, sorted by their
+     * first point.
+     */
+    const std::vector<Extent> & extents() const;
+
+    /**
+     * @param i the index of a point.
+     * @return a circulator on this point.
+     */
+    ConstIterator circulator( const Index i ) const;
+
+    /**
+     * @param k the index of a maximal segment.
+     * @return the maximal segment, recognized from its extent.
+     */
+    SegmentComputer segment( const Index k ) const;
+
+    /**
+     * @param i the index of a point.
+     * @return the index of the most centered maximal segment of the
+     * point i (the one used by eval()).
+     */
+    Index mostCentered( const Index i ) const;
+
+    /**
+     * @return the number of maximal segments recognized by the last
+     * call to init() or splice().
+     */
+    Size nbRecomputed() const;
+
+    /**
+     * @return the first point whose most centered maximal segment may
+     * have changed with the last call to init() or splice().
+     */
+    Index changedBegin() const;
+
+    /**
+     * @return the number of points, from changedBegin(), whose most
+     * centered maximal segment may have changed with the last call
+     * to init() or splice().
+     */
+    Size nbChanged() const;
+
+    /**
+     * Estimation from the most centered maximal segments on the
+     * points [first,first+n) (modulo the number of points).
+     *
+     * @param aSCEstimator a model of CSegmentComputerEstimator on
+     * SegmentComputer.
+     * @param h the grid step.
+     * @param first the index of the first point.
+     * @param n the number of points.
+     * @param result output iterator on the estimated quantities.
+     * @return the output iterator after the last estimation.
+     */
+    template <typename SCEstimator, typename OutputIterator>
+    OutputIterator eval( SCEstimator & aSCEstimator, const double h,
+                         const Index first, const Size n,
+                         OutputIterator result ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The segment computer used to recognize the segments.
+    SegmentComputer mySC;
+    /// The codes of the chain.
+    std::string myCodes;
+    /// The points of the curve (the last one is not repeated).
+    Range myPoints;
+    /// The extents of the maximal segments, sorted by their first point.
+    std::vector<Extent> myExtents;
+    /// The number of segments recognized by the last update.
+    Size myNbRecomputed;
+    /// The first point whose estimation may have changed.
+    Index myChangedBegin;
+    /// The number of points whose estimation may have changed.
+    Size myNbChanged;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes all the maximal segments of the curve.
+     */
+    void computeAll();
+
+    /**
+     * @param e the extent of a segment.
+     * @return the segment, recognized from its first point.
+     */
+    SegmentComputer recognize( const Extent & e ) const;
+
+    /**
+     * @param s a segment computer on the points of the curve.
+     * @return its extent.
+     */
+    Extent extent( const SegmentComputer & s ) const;
+
+    /**
+     * Sorts the extents given in the order of the curve by their
+     * first point.
+     */
+    void sortExtents();
+
+    /**
+     * @param a the extent of a maximal segment.
+     * @param b the extent of the next maximal segment.
+     * @return the index of the last point whose most centered maximal
+     * segment is @a a rather than @a b (the middle of their
+     * intersection).
+     */
+    Index middle( const Extent & a, const Extent & b ) const;
+
+  }; // end of class MaximalSegmentCover
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MaximalSegmentCover'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MaximalSegmentCover' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MaximalSegmentCover<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/MaximalSegmentCover.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MaximalSegmentCover_h
+
+#undef MaximalSegmentCover_RECURSES
+#endif // else defined(MaximalSegmentCover_RECURSES)
@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MinimumVertexSimplification.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module MinimumVertexSimplification.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MinimumVertexSimplification_RECURSES)
+#error Recursive header files inclusion detected in MinimumVertexSimplification.h
+#else // defined(MinimumVertexSimplification_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MinimumVertexSimplification_RECURSES
+
+#if !defined MinimumVertexSimplification_h
+/** Prevents repeated inclusion of headers. */
+#define MinimumVertexSimplification_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MinimumVertexSimplification
+  /**
+   * Description of template class 'MinimumVertexSimplification' <p>
+   * \brief Aim: Computes a simplification of a range of points with a
+   * minimal number of vertices, the segments between two consecutive
+   * vertices being accepted by a segment computer, e.g. FrechetShortcut
+   * or FlatFrechetShortcut for a given error.
+   *
+   * Contrary to GreedySegmentation, which extends each segment as far
+   * as possible from the end of the previous one, the segment computer
+   * is extended from every point of the range. The segments from the
+   * point i are the ones ending at the points i+1 to reach(i), where
+   * reach(i) is the last point added by extendForward() before its
+   * first failure. These segments are the edges of a directed acyclic
+   * graph on the points, in which a shortest path from the first to the
+   * last point is a simplification with a minimal number of vertices.
+   * Since the successors of a point are an interval, the graph is never
+   * built: a breadth first search visits the points by layers of
+   * consecutive points, the layer k+1 ending at the maximal reach of the
+   * layer k. Only reach() and the bounds of the layers are stored.
+   *
+   * The extensions from a point are stopped after @a window points (0
+   * for no limit): the time is then in O(n.window) and the result is
+   * minimal among the simplifications whose segments have at most @a
+   * window points. The first and the last points of the range are
+   * vertices, as with GreedySegmentation.
+   *
+   * @code
+   * typedef FlatFrechetShortcut<std::vector<Z2i::Point>::const_iterator, int> SegmentComputer;
+   * MinimumVertexSimplification<SegmentComputer> simplification
+   *   ( contour.begin(), contour.end(), SegmentComputer( error ) );
+   * for ( unsigned int i = 0; i < simplification.vertices().size(); ++i )
+   *   trace.info() << *( simplification.vertices()[ i ] ) << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer a model of CForwardSegmentComputer.
+   *
+   * @see GreedySegmentation, FrechetShortcut, testMinimumVertexSimplification.cpp
+   */
+  template <typename TSegmentComputer>
+  class MinimumVertexSimplification
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( CForwardSegmentComputer<TSegmentComputer> ));
+
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the simplification of [itb,ite).
+     * @param itb begin iterator of the range.
+     * @param ite end iterator of the range.
+     * @param aSegmentComputer the segment computer (with its
+     * parameters, e.g. the error).
+     * @param window the maximal number of points of a segment (0 for
+     * no limit).
+     */
+    MinimumVertexSimplification( const ConstIterator & itb,
+                                 const ConstIterator & ite,
+                                 const SegmentComputer & aSegmentComputer,
+                                 const Size window = 0 );
+
+    /**
+     * @return the iterators on the vertices, from the first to the
+     * last point of the range (no vertex for an empty range).
+     */
+    const std::vector<ConstIterator> & vertices() const;
+
+    /**
+     * @return the number of segments of the simplification.
+     */
+    Size size() const;
+
+    /**
+     * @return the maximal number of points of a segment (0 for no limit).
+     */
+    Size window() const;
+
+    /**
+     * @return the number of calls to extendForward(), which gives the
+     * cost of the computation.
+     */
+    Size nbExtensions() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The maximal number of points of a segment.
+    Size myWindow;
+    /// The number of calls to extendForward().
+    Size myNbExtensions;
+    /// The vertices.
+    std::vector<ConstIterator> myVertices;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the simplification.
+     */
+    void compute( const ConstIterator & itb, const ConstIterator & ite,
+                  const SegmentComputer & aSegmentComputer );
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * Forbidden by default.
+     */
+    MinimumVertexSimplification();
+
+  }; // end of class MinimumVertexSimplification
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MinimumVertexSimplification'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MinimumVertexSimplification' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const MinimumVertexSimplification<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/MinimumVertexSimplification.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MinimumVertexSimplification_h
+
+#undef MinimumVertexSimplification_RECURSES
+#endif // else defined(MinimumVertexSimplification_RECURSES)
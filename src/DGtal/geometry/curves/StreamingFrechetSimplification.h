@@ -0,0 +1,231 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingFrechetSimplification.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module StreamingFrechetSimplification.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingFrechetSimplification_RECURSES)
+#error Recursive header files inclusion detected in StreamingFrechetSimplification.h
+#else // defined(StreamingFrechetSimplification_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingFrechetSimplification_RECURSES
+
+#if !defined StreamingFrechetSimplification_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingFrechetSimplification_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingFrechetSimplification
+  /**
+   * Description of template class 'StreamingFrechetSimplification' <p>
+   * \brief Aim: On-line simplification of a stream of points, given
+   * one by one, with the same vertices as the greedy segmentation
+   * (see GreedySegmentation) into Fréchet shortcuts of the whole
+   * sequence of points.
+   *
+   * Only the current shortcut is kept, as a FlatFrechetShortcut built
+   * on points (see FlatFrechetShortcut::extendForward(const Point &)):
+   * when a point can't be added to it, its last point is a vertex of
+   * the simplification and the next shortcut starts from there. The
+   * vertices are written to an output iterator as soon as they are
+   * known: the first point of the stream when it is pushed, the other
+   * ones when their shortcut ends, and the last point of the stream
+   * when flush() is called.
+   *
+   * The memory used by the shortcut grows with the number of its
+   * points, and is kept from a shortcut to the next one. Its ceiling
+   * is fixed by giving a maximal number of points per shortcut: a
+   * shortcut reaching it is ended as if the next point could not be
+   * added. Without such a limit, the vertices are exactly the ones of
+   * GreedySegmentation< FlatFrechetShortcut<...> > (the first points
+   * of the segments, followed by the last point).
+   *
+   * @code
+   * std::vector<Z2i::Point> vertices;
+   * typedef std::back_insert_iterator< std::vector<Z2i::Point> > Output;
+   * StreamingFrechetSimplification<Z2i::Point, Output> simplification
+   *   ( std::back_inserter( vertices ), error );
+   * while ( ... )
+   *   simplification.push( p );
+   * simplification.flush();
+   * @endcode
+   *
+   * @tparam TPoint a type of 2D digital point.
+   * @tparam TOutputIterator an output iterator on points, which
+   * receives the vertices (e.g. a back_insert_iterator or a
+   * boost::function_output_iterator calling a callback).
+   *
+   * @see FlatFrechetShortcut, testStreamingFrechetSimplification.cpp
+   */
+  template <typename TPoint, typename TOutputIterator>
+  class StreamingFrechetSimplification
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TPoint Point;
+    typedef TOutputIterator OutputIterator;
+    typedef typename Point::Coordinate Integer;
+    typedef std::size_t Size;
+    /// The segment computer, only used on points.
+    typedef FlatFrechetShortcut<typename std::vector<Point>::const_iterator, Integer> SegmentComputer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param out the output iterator receiving the vertices.
+     * @param error the maximal Fréchet distance.
+     * @param flagWidthOnly if 'true', only the width is tested.
+     * @param maxLength the maximal number of points of a shortcut (0
+     * for no limit).
+     */
+    StreamingFrechetSimplification( const OutputIterator & out, double error,
+                                    bool flagWidthOnly = false,
+                                    Size maxLength = 0 );
+
+    /**
+     * Adds the next point of the stream.
+     * @param p the point.
+     */
+    void push( const Point & p );
+
+    /**
+     * Ends the stream: writes its last point. The next point pushed
+     * starts a new stream.
+     */
+    void flush();
+
+    /**
+     * @return the output iterator, after the vertices written so far.
+     */
+    OutputIterator output() const;
+
+    /**
+     * @return the number of points of the current stream.
+     */
+    Size nbPoints() const;
+
+    /**
+     * @return the number of vertices written for the current stream.
+     */
+    Size nbVertices() const;
+
+    /**
+     * @return the number of points of the current shortcut.
+     */
+    Size length() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output iterator.
+    OutputIterator myOut;
+    /// The current shortcut.
+    SegmentComputer myShortcut;
+    /// The maximal number of points of a shortcut (0 for no limit).
+    Size myMaxLength;
+    /// The number of points of the current shortcut.
+    Size myLength;
+    /// The number of points of the stream.
+    Size myNbPoints;
+    /// The number of vertices of the stream.
+    Size myNbVertices;
+    /// The last point of the current shortcut.
+    Point myLastP;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Writes a vertex and starts a shortcut from it.
+     * @param p the vertex.
+     */
+    void addVertex( const Point & p );
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * Forbidden by default.
+     */
+    StreamingFrechetSimplification();
+
+  }; // end of class StreamingFrechetSimplification
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingFrechetSimplification'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingFrechetSimplification' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TOutputIterator>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const StreamingFrechetSimplification<TPoint, TOutputIterator> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/StreamingFrechetSimplification.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingFrechetSimplification_h
+
+#undef StreamingFrechetSimplification_RECURSES
+#endif // else defined(StreamingFrechetSimplification_RECURSES)
@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IncrementalMostCenteredMaximalSegmentEstimator.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module IncrementalMostCenteredMaximalSegmentEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IncrementalMostCenteredMaximalSegmentEstimator_RECURSES)
+#error Recursive header files inclusion detected in IncrementalMostCenteredMaximalSegmentEstimator.h
+#else // defined(IncrementalMostCenteredMaximalSegmentEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IncrementalMostCenteredMaximalSegmentEstimator_RECURSES
+
+#if !defined IncrementalMostCenteredMaximalSegmentEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IncrementalMostCenteredMaximalSegmentEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/estimation/CSegmentComputerEstimator.h"
+#include "DGtal/geometry/curves/MaximalSegmentCover.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IncrementalMostCenteredMaximalSegmentEstimator
+  /**
+   * Description of template class 'IncrementalMostCenteredMaximalSegmentEstimator' <p>
+   * \brief Aim: Stores the quantities estimated on each point of a
+   * closed curve from its most centered maximal segment, as
+   * MostCenteredMaximalSegmentEstimator, and updates them after a
+   * local edit of the curve.
+   *
+   * The maximal segments are stored in a MaximalSegmentCover. After an
+   * edit (see splice()), the quantities of the points far from the
+   * edit are moved with their points, and only the quantities of the
+   * points whose most centered maximal segment may have changed (see
+   * MaximalSegmentCover::changedBegin()) are estimated again.
+   *
+   * @code
+   * typedef std::vector<Z2i::Point>::const_iterator Iterator;
+   * typedef ArithmeticalDSS<Circulator<Iterator>, int, 4> SegmentComputer;
+   * typedef TangentFromDSSEstimator<SegmentComputer> SCEstimator;
+   * SegmentComputer sc;
+   * SCEstimator f;
+   * IncrementalMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator>
+   *   estimator( sc, f );
+   * estimator.init( 1, chain );
+   * estimator.splice( 10, 13, "01011" );
+   * trace.info() << estimator.eval( 11 ) << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer a model of CForwardSegmentComputer on
+   * circulators on a vector of points (see MaximalSegmentCover).
+   * @tparam TSCEstimator a model of CSegmentComputerEstimator.
+   *
+   * @see MostCenteredMaximalSegmentEstimator, MaximalSegmentCover,
+   * testIncrementalMostCenteredMSEstimator.cpp
+   */
+  template <typename TSegmentComputer, typename TSCEstimator>
+  class IncrementalMostCenteredMaximalSegmentEstimator
+  {
+
+    BOOST_CONCEPT_ASSERT(( CSegmentComputerEstimator<TSCEstimator> ));
+    BOOST_STATIC_ASSERT(( boost::is_same< TSegmentComputer,
+                          typename TSCEstimator::SegmentComputer >::value ));
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TSegmentComputer SegmentComputer;
+    typedef TSCEstimator SCEstimator;
+    typedef MaximalSegmentCover<SegmentComputer> Cover;
+    typedef typename Cover::FreemanChainType FreemanChainType;
+    typedef typename Cover::Index Index;
+    typedef typename Cover::Size Size;
+    typedef typename SCEstimator::Quantity Quantity;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aSegmentComputer a segment computer
+     * @param aSCEstimator an estimator
+     */
+    IncrementalMostCenteredMaximalSegmentEstimator( const SegmentComputer & aSegmentComputer,
+                                                    const SCEstimator & aSCEstimator );
+
+    /**
+     * Initialisation: computes the maximal segments and the
+     * quantities of all the points of a closed curve.
+     * @param h grid size (must be >0).
+     * @param aChain a closed Freeman chain.
+     */
+    void init( const double h, const FreemanChainType & aChain );
+
+    /**
+     * Replaces the codes [first,last) of the chain by @a codes (see
+     * MaximalSegmentCover::splice()) and updates the quantities.
+     * @param first index of the first replaced code.
+     * @param last index after the last replaced code.
+     * @param codes the new codes, with the same displacement as the
+     * replaced ones.
+     */
+    void splice( const Index first, const Index last, const std::string & codes );
+
+    /**
+     * @param i the index of a point.
+     * @return the quantity estimated at the point i.
+     */
+    const Quantity & eval( const Index i ) const;
+
+    /**
+     * @return the quantities estimated at each point.
+     */
+    const std::vector<Quantity> & quantities() const;
+
+    /**
+     * @return the maximal segments of the curve.
+     */
+    const Cover & cover() const;
+
+    /**
+     * @return the number of quantities estimated by the last call to
+     * init() or splice().
+     */
+    Size nbRefreshed() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /** grid step */
+    double myH;
+
+    /** maximal segments of the curve */
+    Cover myCover;
+
+    /** object estimating the quantity from segmentComputer */
+    SCEstimator mySCEstimator;
+
+    /** quantity of each point */
+    std::vector<Quantity> myQuantities;
+
+    /** number of quantities estimated by the last update */
+    Size myNbRefreshed;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Estimates the quantities of the points given by
+     * Cover::changedBegin() and Cover::nbChanged().
+     */
+    void refresh();
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    IncrementalMostCenteredMaximalSegmentEstimator ( const IncrementalMostCenteredMaximalSegmentEstimator & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    IncrementalMostCenteredMaximalSegmentEstimator & operator= ( const IncrementalMostCenteredMaximalSegmentEstimator & other );
+
+  }; // end of class IncrementalMostCenteredMaximalSegmentEstimator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IncrementalMostCenteredMaximalSegmentEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IncrementalMostCenteredMaximalSegmentEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer, typename TSCEstimator>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IncrementalMostCenteredMaximalSegmentEstimator<TSegmentComputer, TSCEstimator> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/IncrementalMostCenteredMaximalSegmentEstimator.ih"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IncrementalMostCenteredMaximalSegmentEstimator_h
+
+#undef IncrementalMostCenteredMaximalSegmentEstimator_RECURSES
+#endif // else defined(IncrementalMostCenteredMaximalSegmentEstimator_RECURSES)
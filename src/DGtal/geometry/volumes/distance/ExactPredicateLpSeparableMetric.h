@@ -203,6 +203,33 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    /** 
+     * Same predicate as hiddenBy when the sites are given by their
+     * coordinates along dimension dim and by their partial distances
+     * to the straight line, i.e. @f$ \sum_{i\neq dim} |s_i -
+     * startingPoint_i|^p@f$. Used by the row kernels
+     * (SeparableMetricRowKernel) which compute the partial distance
+     * of a site once per row.
+     *
+     * @pre udim < vdim < wdim
+     * 
+     * @param udim coordinate of u along dimension dim
+     * @param nu partial distance of u
+     * @param vdim coordinate of v along dimension dim
+     * @param nv partial distance of v
+     * @param wdim coordinate of w along dimension dim
+     * @param nw partial distance of w
+     * @param lower coordinate of the starting point along dimension dim
+     * @param upper coordinate of the end point along dimension dim
+     * 
+     * @return true if (u,w) hides v (strictly).
+     */ 
+    bool hiddenBy(const Abscissa &udim, const Promoted &nu,
+                  const Abscissa &vdim, const Promoted &nv,
+                  const Abscissa &wdim, const Promoted &nw,
+                  const Abscissa &lower,
+                  const Abscissa &upper) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -395,6 +422,33 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    /** 
+     * Same predicate as hiddenBy when the sites are given by their
+     * coordinates along dimension dim and by their partial distances
+     * to the straight line, i.e. @f$ \sum_{i\neq dim} (s_i -
+     * startingPoint_i)^2@f$. Used by the row kernels
+     * (SeparableMetricRowKernel) which compute the partial distance
+     * of a site once per row.
+     *
+     * @pre udim < vdim < wdim
+     * 
+     * @param udim coordinate of u along dimension dim
+     * @param nu partial distance of u
+     * @param vdim coordinate of v along dimension dim
+     * @param nv partial distance of v
+     * @param wdim coordinate of w along dimension dim
+     * @param nw partial distance of w
+     * @param lower coordinate of the starting point along dimension dim
+     * @param upper coordinate of the end point along dimension dim
+     * 
+     * @return true if (u,w) hides v (strictly).
+     */ 
+    bool hiddenBy(const Abscissa &udim, const Promoted &nu,
+                  const Abscissa &vdim, const Promoted &nv,
+                  const Abscissa &wdim, const Promoted &nw,
+                  const Abscissa &lower,
+                  const Abscissa &upper) const;
+
    // ----------------------- Other services --------------------------------------
     /**
      * Writes/Displays the object on an output stream.
@@ -55,48 +55,13 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidatePoints.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace details
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) 
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -123,7 +88,10 @@ namespace DGtal
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
    * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value) by default, but you are free to use 
+   * FMMCandidateHeap, an indexed binary heap in which the 
+   * tentative value of a candidate is updated in place. 
+   * @see FMMCandidatePoints.h
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -131,6 +99,8 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidatePoints  container of candidate points, 
+   * FMMCandidateSet by default or FMMCandidateHeap
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMDef
@@ -143,7 +113,9 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>, 
+	    typename TCandidatePoints = FMMCandidateSet<typename TImage::Point, 
+							typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -180,8 +152,8 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     details::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef TCandidatePoints CandidatePointSet; 
+    BOOST_STATIC_ASSERT(( boost::is_same< PointValue, typename CandidatePointSet::PointValue >::value ));
     typedef unsigned long Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -509,9 +481,10 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor, 
+	    typename TCandidatePoints >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidatePoints> & object );
 
 } // namespace DGtal
 
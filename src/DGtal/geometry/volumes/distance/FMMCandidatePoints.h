@@ -0,0 +1,406 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidatePoints.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * @brief Containers of candidate points (narrow band) used by FMM
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FMMCandidatePoints_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidatePoints.h
+#else // defined(FMMCandidatePoints_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidatePoints_RECURSES
+
+#if !defined FMMCandidatePoints_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidatePoints_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace details
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMCandidateSet
+  /**
+   * Description of template class 'FMMCandidateSet' <p>
+   * \brief Aim: Set of candidate points of FMM, ordered by
+   * (absolute) distance value, based on a STL set of pairs
+   * (point, tentative value).
+   *
+   * A point may be inserted several times with different
+   * tentative values: the pair of smallest value is extracted
+   * first and the other ones are ignored by FMM when they are
+   * extracted since the point is already accepted.
+   * Each insertion allocates a node of the set.
+   *
+   * This is the default container of candidate points of FMM.
+   *
+   * @tparam TPoint type of point
+   * @tparam TValue type of distance value
+   *
+   * @see FMMCandidateHeap
+   */
+  template <typename TPoint, typename TValue>
+  class FMMCandidateSet
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+  private:
+    typedef std::set<PointValue,
+		     details::PointValueCompare<PointValue> > Container;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     */
+    FMMCandidateSet() {}
+
+    /**
+     * Constructor from a domain, which is ignored
+     * (same interface as FMMCandidateHeap).
+     */
+    template <typename TDomain>
+    FMMCandidateSet(const TDomain& /*aDomain*/) {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return 'true' if there is no candidate.
+     */
+    bool empty() const { return myContainer.empty(); }
+
+    /**
+     * @return the number of pairs (point, value) stored.
+     */
+    Size size() const { return myContainer.size(); }
+
+    /**
+     * @return the pair of smallest (absolute) value.
+     * The container must not be empty.
+     */
+    const PointValue& top() const { return *myContainer.begin(); }
+
+    /**
+     * Removes the pair of smallest (absolute) value.
+     * The container must not be empty.
+     */
+    void pop() { myContainer.erase( myContainer.begin() ); }
+
+    /**
+     * Inserts a new pair (point, value).
+     *
+     * @param aPair any pair (point, tentative value)
+     *
+     * @return 'true' if inserted, 'false' otherwise
+     */
+    bool insert(const PointValue& aPair) { return myContainer.insert( aPair ).second; }
+
+    /**
+     * Removes all the candidates.
+     */
+    void clear() { myContainer.clear(); }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[FMMCandidateSet] " << size() << " pairs";
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const { return true; }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Set of pairs (point, value)
+     */
+    Container myContainer;
+
+  }; // end of class FMMCandidateSet
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMCandidateHeap
+  /**
+   * Description of template class 'FMMCandidateHeap' <p>
+   * \brief Aim: Set of candidate points of FMM, stored in an
+   * indexed binary heap ordered by (absolute) distance value.
+   *
+   * Each point is stored at most once: the position of a point
+   * in the heap is stored in an image (0 if the point is not
+   * in the heap) so that the tentative value of a point already
+   * in the heap is updated in place (decrease-key) in O(log n)
+   * without any allocation. The heap is stored in a STL vector
+   * that is only resized when the narrow band grows.
+   *
+   * Since the pairs are extracted in the same order as with
+   * FMMCandidateSet, FMM returns exactly the same values with
+   * both containers.
+   *
+   * You can use it in FMM as follows:
+   * @code
+   typedef ImageContainerBySTLVector<Domain, unsigned int> SlotImage;
+   typedef FMMCandidateHeap<SlotImage, double> Candidates;
+   typedef FMM<Image, Set, Domain::Predicate,
+               L2FirstOrderLocalDistance<Image, Set>, Candidates > FMM;
+   * @endcode
+   *
+   * @tparam TSlotImage any model of CImage, whose values are of
+   * integral type and are equal to 0 by default, which can be
+   * constructed from a domain (e.g. ImageContainerBySTLVector for
+   * a dense band, ImageContainerBySTLMap for a sparse band in a
+   * large domain).
+   * @tparam TValue type of distance value
+   *
+   * @see FMMCandidateSet
+   * @see testFMM.cpp
+   */
+  template <typename TSlotImage, typename TValue>
+  class FMMCandidateHeap
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CImage<TSlotImage> ));
+
+    typedef TSlotImage SlotImage;
+    typedef typename SlotImage::Domain Domain;
+    typedef typename SlotImage::Point Point;
+    typedef typename SlotImage::Value Slot;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain domain of the image of positions
+     */
+    FMMCandidateHeap(const Domain& aDomain);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return 'true' if there is no candidate.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of candidates.
+     */
+    Size size() const;
+
+    /**
+     * @return the pair of smallest (absolute) value.
+     * The heap must not be empty.
+     */
+    const PointValue& top() const;
+
+    /**
+     * Removes the pair of smallest (absolute) value.
+     * The heap must not be empty.
+     */
+    void pop();
+
+    /**
+     * Inserts the point of @a aPair with its value if it
+     * is not in the heap, but otherwise replaces its value
+     * if the new value is smaller (in absolute value).
+     *
+     * @param aPair any pair (point, tentative value)
+     *
+     * @return 'true' if inserted or updated, 'false' otherwise
+     */
+    bool insert(const PointValue& aPair);
+
+    /**
+     * Removes all the candidates.
+     */
+    void clear();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object, i.e.
+     * the heap property and the positions stored in the image.
+     * In O(n).
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Image that stores, for each point, its position
+     * in the heap plus one (0 if not in the heap)
+     */
+    SlotImage mySlots;
+
+    /**
+     * Binary heap of pairs (point, value)
+     */
+    std::vector<PointValue> myHeap;
+
+    /**
+     * Comparator of pairs (point, value)
+     */
+    details::PointValueCompare<PointValue> myCompare;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Stores @a aPair at position @a i of the heap.
+     *
+     * @param i any position of the heap
+     * @param aPair any pair (point, value)
+     */
+    void place(Size i, const PointValue& aPair);
+
+    /**
+     * Moves up the pair @a aPair, from position @a i,
+     * until the heap property is restored.
+     *
+     * @param i any position of the heap
+     * @param aPair any pair (point, value)
+     */
+    void siftUp(Size i, const PointValue& aPair);
+
+    /**
+     * Moves down the pair @a aPair, from position @a i,
+     * until the heap property is restored.
+     *
+     * @param i any position of the heap
+     * @param aPair any pair (point, value)
+     */
+    void siftDown(Size i, const PointValue& aPair);
+
+  }; // end of class FMMCandidateHeap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FMMCandidateSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FMMCandidateSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FMMCandidateSet<TPoint, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FMMCandidateHeap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FMMCandidateHeap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSlotImage, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FMMCandidateHeap<TSlotImage, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidatePoints.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidatePoints_h
+
+#undef FMMCandidatePoints_RECURSES
+#endif // else defined(FMMCandidatePoints_RECURSES)
@@ -0,0 +1,343 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @brief Distance transformation of volumes streamed from disk
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module OutOfCoreDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricRowKernel.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Distance transformation of 3D volumes that do not fit
+   * in memory. The volume is streamed from a file (Vol or raw 8 bits
+   * format) and the distance map is written to a raw file, using a
+   * bounded amount of memory.
+   *
+   * The computation follows the separable Voronoi map construction
+   * of VoronoiMap (hence, the results are the ones of
+   * DistanceTransformation, for any model of CSeparableMetric):
+   *
+   * - the volume is read by slabs of consecutive z-slices. The 1D
+   * problems along x and y only involve the voxels of a slice, so
+   * that they are solved slice by slice. The partial Voronoi map
+   * (the closest site of each voxel) is written to a temporary file
+   * (12 bytes per voxel for 32 bits coordinates).
+   *
+   * - the 1D problems along z are then solved by blocks of
+   * consecutive columns: for each slice, the sites of the block are
+   * read from the temporary file, the lower envelope is computed
+   * along each column and the distances are written to the output
+   * file.
+   *
+   * The thickness of the slabs and the size of the blocks are
+   * deduced from the memory budget given at construction. The
+   * temporary file needs as much disk space as the
+   * ImageContainerBySTLVector of VoronoiMap needs memory.
+   *
+   * Voxels whose value is greater than a threshold (0 by default)
+   * are the points at which the distance to the closest site is
+   * computed (as with SimpleThresholdForegroundPredicate). The output
+   * file contains one value of type TOutputValue per voxel, in the
+   * order of the input voxels (x first, then y, then z) and in the
+   * native byte order.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the 1D problems of a slab or of a block are solved in
+   * parallel.
+   *
+   * @code
+   * typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+   * L2Metric l2;
+   * // at most 512MB in memory
+   * OutOfCoreDistanceTransformation<Z3i::Space, L2Metric, float>
+   *   dt( l2, 512*1024*1024 );
+   * dt.computeFromVol( "volume.vol", "distance.raw" );
+   * @endcode
+   *
+   * @tparam TSpace type of 3D Digital Space (model of CSpace).
+   * @tparam TSeparableMetric a model of CSeparableMetric
+   * @tparam TOutputValue type of the values written in the output
+   * file (default: the value type of the metric).
+   */
+  template < typename TSpace,
+             typename TSeparableMetric,
+             typename TOutputValue = typename TSeparableMetric::Value >
+  class OutOfCoreDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( CSeparableMetric<TSeparableMetric> ));
+
+    ///Only 3D volumes are supported
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Type of the values of the output file
+    typedef TOutputValue OutputValue;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Type of the row kernel solving the 1D problems
+    typedef SeparableMetricRowKernel<SeparableMetric> RowKernel;
+
+    ///Type of sizes and offsets in files
+    typedef DGtal::uint64_t Size;
+
+    /**
+     * Constructor.
+     *
+     * @param aMetric the separable metric instance.
+     * @param aMemoryBudget the amount of memory (in bytes) used to
+     * store the slabs and the blocks of columns (256MB by default).
+     */
+    OutOfCoreDistanceTransformation(ConstAlias<SeparableMetric> aMetric,
+                                    Size aMemoryBudget = 256*1024*1024);
+
+    /**
+     * Default destructor
+     */
+    ~OutOfCoreDistanceTransformation();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the distance transformation of a raw volume of
+     * voxels of 8 bits (see RawReader).
+     *
+     * @param inputFilename the raw file.
+     * @param extent the size of the volume.
+     * @param outputFilename the raw file of distances.
+     * @param threshold distances are computed at the voxels whose
+     * value is greater than @a threshold.
+     * @param offset the offset of the first voxel in the input file.
+     *
+     * @throw IOException if a file can't be read or written.
+     */
+    void computeFromRaw(const std::string & inputFilename,
+                        const Vector & extent,
+                        const std::string & outputFilename,
+                        const unsigned char threshold = 0,
+                        const Size offset = 0);
+
+    /**
+     * Computes the distance transformation of a Vol file (see
+     * VolReader).
+     *
+     * @param inputFilename the Vol file.
+     * @param outputFilename the raw file of distances.
+     * @param threshold distances are computed at the voxels whose
+     * value is greater than @a threshold.
+     *
+     * @return the size of the volume.
+     * @throw IOException if a file can't be read or written.
+     */
+    Vector computeFromVol(const std::string & inputFilename,
+                          const std::string & outputFilename,
+                          const unsigned char threshold = 0);
+
+    /**
+     * @return the memory budget (in bytes).
+     */
+    Size memoryBudget() const;
+
+    /**
+     * @return the number of slices of a slab during the last
+     * computation.
+     */
+    Size slabThickness() const;
+
+    /**
+     * @return the number of columns of a block during the last
+     * computation.
+     */
+    Size blockSize() const;
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Solves the 1D problems along x and y, slab by slab, and writes
+     * the partial Voronoi map to @a sites.
+     *
+     * @param in the input file, positioned on the first voxel.
+     * @param sites the temporary file of sites.
+     * @param threshold threshold of the foreground voxels.
+     */
+    void computeSlices(std::istream & in, std::ostream & sites,
+                       const unsigned char threshold);
+
+    /**
+     * Solves the 1D problems along z, block by block, and writes the
+     * distances to @a out.
+     *
+     * @param sites the temporary file of sites.
+     * @param out the output file.
+     */
+    void computeColumns(std::istream & sites, std::ostream & out);
+
+    /**
+     * Given a Voronoi map valid at dimension @a dim-1 along a row of
+     * a buffer, updates the row to make it consistent at dimension
+     * @a dim (same process as VoronoiMap::computeOtherStep1D).
+     *
+     * @param row pointer to the first site of the row.
+     * @param stride distance between two consecutive sites of the
+     * row in the buffer.
+     * @param startingPoint first point of the row.
+     * @param dim dimension of the update.
+     * @param kernel row kernel, whose buffers are reused from one
+     * row to another.
+     */
+    void computeStep1D(Point * row, const std::ptrdiff_t stride,
+                       const Point & startingPoint, const Dimension dim,
+                       RowKernel & kernel) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Memory budget
+    Size myMemoryBudget;
+
+    ///Size of the current volume
+    Vector myExtent;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Number of slices of a slab
+    Size mySlabThickness;
+
+    ///Number of columns of a block
+    Size myBlockSize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    OutOfCoreDistanceTransformation ( const OutOfCoreDistanceTransformation & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    OutOfCoreDistanceTransformation & operator= ( const OutOfCoreDistanceTransformation & other );
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename Sep, typename V>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreDistanceTransformation<S,Sep,V> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
@@ -81,6 +81,11 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the 1D problems of each dimension are solved in
+   * parallel, by batches of rows, each thread reusing its own buffer
+   * of sites (see VoronoiMap).
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TWeightImage model of CConstImage
@@ -257,11 +262,16 @@ namespace DGtal
      * the 1D span starting at @a row along the dimension @a
      * dim.
      * 
+     * At dimension 0, the map is initialized from the weight
+     * image domain.
+     * 
      * @param row starting point of the 1D process.
      * @param dim dimension of the update.
+     * @param Sites buffer of sites, reused from one row to another.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+			     std::vector<Point> &Sites) const;
     
     // ------------------- protected methods ------------------------
   protected:
@@ -0,0 +1,394 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SeparableMetricRowKernel.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * @brief Lower envelope of the sites of a row for the separable
+ * Voronoi map construction.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testVoronoiMap.cpp
+ */
+
+#if defined(SeparableMetricRowKernel_RECURSES)
+#error Recursive header files inclusion detected in SeparableMetricRowKernel.h
+#else // defined(SeparableMetricRowKernel_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SeparableMetricRowKernel_RECURSES
+
+#if !defined SeparableMetricRowKernel_h
+/** Prevents repeated inclusion of headers. */
+#define SeparableMetricRowKernel_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SeparableMetricRowKernel
+  /**
+   * Description of template class 'SeparableMetricRowKernel' <p>
+   * \brief Aim: Solves the 1D problem of the separable Voronoi map
+   * construction along a row [startingPoint, endPoint]: the sites
+   * are pushed in increasing order along the row, the ones whose
+   * Voronoi cell does not intersect the row are removed (lower
+   * envelope) and then the closest site of each point of the row
+   * is given.
+   *
+   * This generic version only uses the hiddenBy and closest
+   * methods of the metric. It is specialized for
+   * ExactPredicateLpSeparableMetric (hence for the @f$ l_1@f$ and
+   * @f$ l_2@f$ metrics): the partial distance of a site to the
+   * row is computed once, when the site is pushed, and is stored
+   * with its abscissa in contiguous integer arrays. The predicates
+   * are then computed on these arrays, without any access to the
+   * other coordinates of the sites, and are still exact.
+   *
+   * The object keeps its buffers from one row to another, so that
+   * one instance per thread is enough (see VoronoiMap).
+   *
+   * @code
+   SeparableMetricRowKernel<L2Metric> kernel( &l2 );
+   kernel.init( startingPoint, endPoint, dim );
+   for ( ... ) //sites of the row, in increasing order along dim
+     kernel.push( site );
+   if ( ! kernel.empty() )
+     for ( ... ) //points of the row, in increasing order along dim
+       voronoi[ p ] = kernel.closest( p );
+   * @endcode
+   *
+   * @tparam TSeparableMetric a model of CSeparableMetric
+   */
+  template <typename TSeparableMetric>
+  class SeparableMetricRowKernel
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CSeparableMetric<TSeparableMetric> ));
+
+    ///Type of the separable metric
+    typedef TSeparableMetric SeparableMetric;
+
+    typedef typename SeparableMetric::Point Point;
+    typedef typename Point::Coordinate Abscissa;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     */
+    SeparableMetricRowKernel(const SeparableMetric * aMetric);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Reserves the buffers for rows of @a n sites.
+     *
+     * @param n the number of sites.
+     */
+    void reserve(const Size n);
+
+    /**
+     * Starts a new row. The sites of the previous row are removed.
+     *
+     * @param startingPoint starting point of the row.
+     * @param endPoint end point of the row.
+     * @param dim direction of the row.
+     */
+    void init(const Point &startingPoint,
+              const Point &endPoint,
+              const Dimension dim);
+
+    /**
+     * Adds a site after removing the previous sites hidden by it.
+     *
+     * @pre the coordinate of @a site along the row is greater than
+     * the one of the previous site.
+     *
+     * @param site a site.
+     */
+    void push(const Point &site);
+
+    /**
+     * Adds a site lying on the row (no previous site can be hidden).
+     *
+     * @pre the coordinate of @a site along the row is greater than
+     * the one of the previous site.
+     *
+     * @param site a site of the row.
+     */
+    void pushOnRow(const Point &site);
+
+    /**
+     * @return 'true' if no site has been pushed.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of sites of the lower envelope.
+     */
+    Size size() const;
+
+    /**
+     * Closest site of a point of the row (the first one in case of
+     * equality, as in VoronoiMap).
+     *
+     * @pre the row is not empty and the points are given in
+     * increasing order along the row.
+     *
+     * @param aPoint a point of the row.
+     * @return the closest site of @a aPoint.
+     */
+    const Point & closest(const Point &aPoint);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Sites of the lower envelope
+    std::vector<Point> mySites;
+
+    ///Starting point of the row
+    Point myStartingPoint;
+
+    ///End point of the row
+    Point myEndPoint;
+
+    ///Direction of the row
+    Dimension myDim;
+
+    ///Index of the closest site of the last point
+    Size myCursor;
+
+  }; // end of class SeparableMetricRowKernel
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SeparableMetricRowKernel
+  /**
+   * Description of template class 'SeparableMetricRowKernel' <p>
+   * \brief Aim: Specialization of SeparableMetricRowKernel for the
+   * exact @f$ l_p@f$ metrics.
+   *
+   * Each site is represented by its abscissa along the row and by
+   * its partial distance @f$ \sum_{i\neq dim} |s_i -
+   * startingPoint_i|^p@f$, stored in two arrays of integers. The
+   * hiddenBy predicate is the one of the metric (in @f$ O(1)@f$ for
+   * p=2) and the closest predicate compares @f$ h_k + |x -
+   * x_k|^p@f$ to @f$ h_{k+1} + |x - x_{k+1}|^p@f$, whatever the
+   * dimension of the space. The results are exactly the ones of the
+   * generic version.
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam p the exponent of the metric.
+   * @tparam TPromoted type used to represent distances.
+   */
+  template <typename TSpace, DGtal::uint32_t p, typename TPromoted>
+  class SeparableMetricRowKernel< ExactPredicateLpSeparableMetric<TSpace, p, TPromoted> >
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    ///Type of the separable metric
+    typedef ExactPredicateLpSeparableMetric<TSpace, p, TPromoted> SeparableMetric;
+
+    typedef typename SeparableMetric::Point Point;
+    typedef typename SeparableMetric::Abscissa Abscissa;
+    typedef typename SeparableMetric::Promoted Promoted;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     */
+    SeparableMetricRowKernel(const SeparableMetric * aMetric);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Reserves the buffers for rows of @a n sites.
+     *
+     * @param n the number of sites.
+     */
+    void reserve(const Size n);
+
+    /**
+     * Starts a new row. The sites of the previous row are removed.
+     *
+     * @param startingPoint starting point of the row.
+     * @param endPoint end point of the row.
+     * @param dim direction of the row.
+     */
+    void init(const Point &startingPoint,
+              const Point &endPoint,
+              const Dimension dim);
+
+    /**
+     * Adds a site after removing the previous sites hidden by it.
+     *
+     * @pre the coordinate of @a site along the row is greater than
+     * the one of the previous site.
+     *
+     * @param site a site.
+     */
+    void push(const Point &site);
+
+    /**
+     * Adds a site lying on the row (no previous site can be hidden).
+     *
+     * @pre the coordinate of @a site along the row is greater than
+     * the one of the previous site.
+     *
+     * @param site a site of the row.
+     */
+    void pushOnRow(const Point &site);
+
+    /**
+     * @return 'true' if no site has been pushed.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of sites of the lower envelope.
+     */
+    Size size() const;
+
+    /**
+     * Closest site of a point of the row (the first one in case of
+     * equality, as in VoronoiMap).
+     *
+     * @pre the row is not empty and the points are given in
+     * increasing order along the row.
+     *
+     * @param aPoint a point of the row.
+     * @return the closest site of @a aPoint.
+     */
+    const Point & closest(const Point &aPoint);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Sites of the lower envelope
+    std::vector<Point> mySites;
+
+    ///Abscissas of the sites along the row
+    std::vector<Abscissa> myAbscissas;
+
+    ///Partial distances of the sites to the row
+    std::vector<Promoted> myPartialDistances;
+
+    ///Starting point of the row
+    Point myStartingPoint;
+
+    ///End point of the row
+    Point myEndPoint;
+
+    ///Direction of the row
+    Dimension myDim;
+
+    ///Index of the closest site of the last point
+    Size myCursor;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param d a difference of coordinates.
+     * @return @f$ |d|^p@f$.
+     */
+    static Promoted power(const Abscissa d);
+
+  }; // end of class SeparableMetricRowKernel
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SeparableMetricRowKernel'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SeparableMetricRowKernel' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSeparableMetric>
+  std::ostream&
+  operator<< ( std::ostream & out, const SeparableMetricRowKernel<TSeparableMetric> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/SeparableMetricRowKernel.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SeparableMetricRowKernel_h
+
+#undef SeparableMetricRowKernel_RECURSES
+#endif // else defined(SeparableMetricRowKernel_RECURSES)
@@ -51,6 +51,7 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricRowKernel.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -89,7 +90,17 @@ namespace DGtal
    * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
    * to "true"), the computation is done in parallel (multithreaded)
    * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * @f$ O(h.d.n^d / p)@f$. The rows of each dimension are
+   * distributed by batches among the threads and each thread reuses
+   * its own buffer of sites, so that no allocation occurs during the
+   * 1D passes. Note that the point predicate is then evaluated
+   * concurrently during the first pass.
+   *
+   * The 1D problems are solved by a SeparableMetricRowKernel. For
+   * ExactPredicateLpSeparableMetric (e.g. the @f$ l_1@f$ and @f$
+   * l_2@f$ metrics), the specialized kernel is selected automatically:
+   * the partial distances of the sites to a row are computed once and
+   * the predicates only involve integer arrays along the row.
    *
    * This class is a model of CConstImage.
    *
@@ -154,6 +165,9 @@ namespace DGtal
     typedef typename Space::Dimension Dimension;
     typedef typename Space::Size Size;
     typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Type of the row kernel solving the 1D problems
+    typedef SeparableMetricRowKernel<SeparableMetric> RowKernel;
  
     ///Type of resulting image
     typedef TImageContainer OutputImage;
@@ -275,11 +289,17 @@ namespace DGtal
      * the 1D span starting at @a row along the dimension @a
      * dim.
      * 
+     * At dimension 0, the map is initialized from the point
+     * predicate.
+     * 
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] kernel row kernel, whose buffers are reused
+     * from one row to another.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+			     RowKernel &kernel) const;
     
     // ------------------- protected methods ------------------------
   protected:
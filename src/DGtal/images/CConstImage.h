@@ -83,7 +83,7 @@ namespace DGtal
 ###  Invariants
 
 ###  Model
-   ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree
+   ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree, ImageContainerByBricks, MappedImageView
   
 ###  Notes
 
@@ -0,0 +1,685 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HashTreeStorage.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module HashTreeStorage.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testHashTree.cpp
+ */
+
+#if defined(HashTreeStorage_RECURSES)
+#error Recursive header files inclusion detected in HashTreeStorage.h
+#else // defined(HashTreeStorage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HashTreeStorage_RECURSES
+
+#if !defined HashTreeStorage_h
+/** Prevents repeated inclusion of headers. */
+#define HashTreeStorage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace experimental
+  {
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChainedHashTreeStorage
+  /**
+   * Description of template class 'ChainedHashTreeStorage' <p>
+   * \brief Aim: Storage of the nodes of an ImageContainerByHashTree
+   * in a hash table whose collisions are handled by linked lists of
+   * nodes allocated one by one.
+   *
+   * The hash of a key is given by its @a hashKeySize least
+   * significant bits, and the table has 2^hashKeySize lists.
+   *
+   * This is the storage historically used by
+   * ImageContainerByHashTree, and its default one.
+   *
+   * @tparam THashKey type of the Morton keys.
+   * @tparam TValue type of the values.
+   *
+   * @see RobinHoodHashTreeStorage
+   */
+  template <typename THashKey, typename TValue>
+  class ChainedHashTreeStorage
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef THashKey HashKey;
+    typedef TValue Value;
+    typedef std::size_t Size;
+
+    /**
+     * A node of a linked list: a pair (key, value).
+     */
+    class Node
+    {
+    public:
+
+      /**
+       * Construtctor: create pair (@a aValue, @a key)
+       *
+       * @param aValue  First value
+       * @param key     key in the hashtree
+       */
+      Node(Value aValue, HashKey key)
+        : myKey( key ), myNext( 0 ), myData( aValue )
+      {}
+
+      /**
+       * @return the next pair (aValue, key) in the list.
+       */
+      inline Node* getNext()
+      {
+        return myNext;
+      }
+
+      /**
+       * Insert the pair (value,key)  @a next in the node list
+       *
+       * @param next a pointer to a pair (value,key) (Node).
+       */
+      inline void setNext(Node* next)
+      {
+        myNext = next;
+      }
+
+      /**
+       * @return the key associated to a Node.
+       */
+      inline HashKey getKey() const
+      {
+        return myKey;
+      }
+
+      /**
+       * @return the object (aValue) associated to a Node.
+       */
+      inline Value& getObject()
+      {
+        return myData;
+      }
+
+    protected:
+      HashKey myKey;
+      Node* myNext;
+      Value myData;
+    };
+
+    /**
+     * Iterator on the nodes, list after list.
+     */
+    class Iterator
+    {
+    public:
+      Iterator(Node** data, unsigned int position, unsigned int arraySize)
+        : myNode( 0 ), myCurrentCell( position ), myArraySize( arraySize ),
+          myContainerData( data )
+      {
+        while ( ( myCurrentCell < myArraySize )
+                && ( ( myNode = myContainerData[ myCurrentCell ] ) == 0 ) )
+          ++myCurrentCell;
+      }
+      bool isAtEnd() const
+      {
+        return myCurrentCell >= myArraySize;
+      }
+      Value& operator*()
+      {
+        return myNode->getObject();
+      }
+      bool operator ++ ()
+      {
+        return next();
+      }
+      bool operator == (const Iterator& it) const
+      {
+        if (isAtEnd() && it.isAtEnd())
+          return true;
+        else
+          return (myNode == it.myNode);
+      }
+      bool operator != (const Iterator& it) const
+      {
+        return ! ( *this == it );
+      }
+      inline HashKey getKey() const
+      {
+        return myNode->getKey();
+      }
+      bool next();
+    protected:
+      Node* myNode;
+      unsigned int myCurrentCell;
+      unsigned int myArraySize;
+      Node** myContainerData;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param hashKeySize the number of bits of the hash (the table
+     * has 2^hashKeySize lists).
+     */
+    ChainedHashTreeStorage( const unsigned int hashKeySize );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ChainedHashTreeStorage( const ChainedHashTreeStorage & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ChainedHashTreeStorage & operator= ( const ChainedHashTreeStorage & other );
+
+    /**
+     * Destructor.
+     */
+    ~ChainedHashTreeStorage();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param key a key.
+     * @return a pointer to the node of @a key, 0 if there is none.
+     */
+    Node* find( const HashKey key ) const;
+
+    /**
+     * Sets the value of a key, adding its node if necessary.
+     * @param key a key.
+     * @param value its value.
+     * @return a pointer to the node of @a key.
+     */
+    Node* insert( const HashKey key, const Value & value );
+
+    /**
+     * Removes the node of a key.
+     * @param key a key.
+     * @return 'false' if there was no node for @a key.
+     */
+    bool erase( const HashKey key );
+
+    /**
+     * Removes all the nodes.
+     */
+    void clear();
+
+    /**
+     * Prepares the storage for @a n nodes (nothing is done here, the
+     * number of lists being fixed).
+     * @param n a number of nodes.
+     */
+    void reserve( const Size n );
+
+    /**
+     * @return the number of nodes.
+     */
+    Size size() const;
+
+    /**
+     * @return the number of lists of the table.
+     */
+    unsigned int nbBuckets() const;
+
+    /**
+     * @param bucket the index of a list.
+     * @return its number of nodes.
+     */
+    unsigned int nbNodes( const unsigned int bucket ) const;
+
+    /**
+     * @return the number of empty lists.
+     */
+    unsigned int nbEmptyBuckets() const;
+
+    /**
+     * @return the average number of collisions, without counting the
+     * empty lists.
+     */
+    double averageCollisions() const;
+
+    /**
+     * @return the highest number of collisions.
+     */
+    unsigned int maxCollisions() const;
+
+    /**
+     * @return the memory used by the table and the nodes, in bytes.
+     */
+    Size memory() const;
+
+    /**
+     * Displays each list of the table.
+     * @param out the output stream.
+     * @param nbBits the number of bits of the keys to display (0 to
+     * hide them).
+     */
+    void printBuckets( std::ostream & out, unsigned int nbBits ) const;
+
+    /**
+     * @return an iterator on the first node.
+     */
+    Iterator begin();
+
+    /**
+     * @return an iterator after the last node.
+     */
+    Iterator end();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The array of linked lists.
+    Node** myBuckets;
+
+    /// The number of bits of the hash.
+    unsigned int myKeySize;
+
+    /// The number of lists.
+    unsigned int myNbBuckets;
+
+    /// The mask of the hash.
+    HashKey myMask;
+
+    /// The number of nodes.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Copies the nodes of another storage, of the same size.
+     * @param other the object to copy.
+     */
+    void copyNodes( const ChainedHashTreeStorage & other );
+
+  }; // end of class ChainedHashTreeStorage
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RobinHoodHashTreeStorage
+  /**
+   * Description of template class 'RobinHoodHashTreeStorage' <p>
+   * \brief Aim: Storage of the nodes of an ImageContainerByHashTree
+   * in a single array of (key, value) pairs, with open addressing
+   * and Robin Hood hashing.
+   *
+   * The key 0, which is never a valid key of a hash tree, marks the
+   * empty slots. A node is placed at the first free slot after the
+   * slot given by the hash of its key (a Fibonacci hashing of the
+   * whole key), the nodes far from their slot taking the place of
+   * the nodes closer to theirs. The distances to the slots (the
+   * collisions) stay small and uniform, a search ends as soon as it
+   * is farther than the node it meets, and a removal shifts the
+   * following nodes backwards (no tombstone). The array doubles when
+   * it is 80% full.
+   *
+   * Contrary to ChainedHashTreeStorage, there is no allocation per
+   * node, the keys and the values are side by side in memory and the
+   * iteration is a linear scan of the array.
+   *
+   * @warning the pointers to the nodes are invalidated by the
+   * insertions and the removals.
+   *
+   * @tparam THashKey type of the Morton keys.
+   * @tparam TValue type of the values.
+   */
+  template <typename THashKey, typename TValue>
+  class RobinHoodHashTreeStorage
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef THashKey HashKey;
+    typedef TValue Value;
+    typedef std::size_t Size;
+
+    /**
+     * A slot of the table: a pair (key, value), empty if the key is 0.
+     */
+    class Node
+    {
+    public:
+
+      Node()
+        : myKey( 0 ), myData()
+      {}
+
+      /**
+       * @return the key associated to a Node.
+       */
+      inline HashKey getKey() const
+      {
+        return myKey;
+      }
+
+      /**
+       * @return the object (aValue) associated to a Node.
+       */
+      inline Value& getObject()
+      {
+        return myData;
+      }
+
+    protected:
+      friend class RobinHoodHashTreeStorage;
+      HashKey myKey;
+      Value myData;
+    };
+
+    /**
+     * Iterator on the nodes, in the order of the array.
+     */
+    class Iterator
+    {
+    public:
+      Iterator(Node* slots, Size position, Size capacity)
+        : mySlots( slots ), myPosition( position ), myCapacity( capacity )
+      {
+        while ( ( myPosition < myCapacity ) && ( mySlots[ myPosition ].getKey() == 0 ) )
+          ++myPosition;
+      }
+      bool isAtEnd() const
+      {
+        return myPosition >= myCapacity;
+      }
+      Value& operator*()
+      {
+        return mySlots[ myPosition ].getObject();
+      }
+      bool operator ++ ()
+      {
+        return next();
+      }
+      bool operator == (const Iterator& it) const
+      {
+        if (isAtEnd() && it.isAtEnd())
+          return true;
+        else
+          return (myPosition == it.myPosition) && (mySlots == it.mySlots);
+      }
+      bool operator != (const Iterator& it) const
+      {
+        return ! ( *this == it );
+      }
+      inline HashKey getKey() const
+      {
+        return mySlots[ myPosition ].getKey();
+      }
+      bool next()
+      {
+        while ( ( ++myPosition < myCapacity ) && ( mySlots[ myPosition ].getKey() == 0 ) )
+          ;
+        return myPosition < myCapacity;
+      }
+    protected:
+      Node* mySlots;
+      Size myPosition;
+      Size myCapacity;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param hashKeySize the logarithm of the initial number of slots.
+     */
+    RobinHoodHashTreeStorage( const unsigned int hashKeySize );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    RobinHoodHashTreeStorage( const RobinHoodHashTreeStorage & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    RobinHoodHashTreeStorage & operator= ( const RobinHoodHashTreeStorage & other );
+
+    /**
+     * Destructor.
+     */
+    ~RobinHoodHashTreeStorage();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param key a key.
+     * @return a pointer to the node of @a key, 0 if there is none.
+     */
+    Node* find( const HashKey key ) const;
+
+    /**
+     * Sets the value of a key, adding its node if necessary.
+     * @param key a key (not 0).
+     * @param value its value.
+     * @return a pointer to the node of @a key.
+     */
+    Node* insert( const HashKey key, const Value & value );
+
+    /**
+     * Removes the node of a key.
+     * @param key a key.
+     * @return 'false' if there was no node for @a key.
+     */
+    bool erase( const HashKey key );
+
+    /**
+     * Removes all the nodes (the capacity is kept).
+     */
+    void clear();
+
+    /**
+     * Enlarges the array so that @a n nodes can be stored without
+     * rehashing.
+     * @param n a number of nodes.
+     */
+    void reserve( const Size n );
+
+    /**
+     * @return the number of nodes.
+     */
+    Size size() const;
+
+    /**
+     * @return the number of slots.
+     */
+    unsigned int nbBuckets() const;
+
+    /**
+     * @param bucket the index of a slot.
+     * @return 1 if the slot is used, 0 otherwise.
+     */
+    unsigned int nbNodes( const unsigned int bucket ) const;
+
+    /**
+     * @return the number of empty slots.
+     */
+    unsigned int nbEmptyBuckets() const;
+
+    /**
+     * @return the average distance of the nodes to their slot.
+     */
+    double averageCollisions() const;
+
+    /**
+     * @return the highest distance of a node to its slot.
+     */
+    unsigned int maxCollisions() const;
+
+    /**
+     * @return the memory used by the array, in bytes.
+     */
+    Size memory() const;
+
+    /**
+     * Displays each slot of the array.
+     * @param out the output stream.
+     * @param nbBits the number of bits of the keys to display (0 to
+     * hide them).
+     */
+    void printBuckets( std::ostream & out, unsigned int nbBits ) const;
+
+    /**
+     * @return an iterator on the first node.
+     */
+    Iterator begin();
+
+    /**
+     * @return an iterator after the last node.
+     */
+    Iterator end();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The array of slots.
+    Node* mySlots;
+
+    /// The logarithm of the number of slots.
+    unsigned int myLogCapacity;
+
+    /// The number of slots.
+    Size myCapacity;
+
+    /// The number of nodes.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param key a key.
+     * @return the slot of @a key.
+     */
+    Size home( const HashKey key ) const;
+
+    /**
+     * @param position a slot.
+     * @param key the key stored in this slot.
+     * @return the distance of @a position to the slot of @a key.
+     */
+    Size distance( const Size position, const HashKey key ) const;
+
+    /**
+     * Inserts a key which is not in the array, without checking the
+     * load factor.
+     * @param key a key.
+     * @param value its value.
+     * @return a pointer to the node of @a key.
+     */
+    Node* insertNew( const HashKey key, const Value & value );
+
+    /**
+     * Moves the nodes to an array of 2^logCapacity slots.
+     * @param logCapacity the logarithm of the new number of slots.
+     */
+    void rehash( const unsigned int logCapacity );
+
+  }; // end of class RobinHoodHashTreeStorage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChainedHashTreeStorage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChainedHashTreeStorage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename THashKey, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChainedHashTreeStorage<THashKey, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RobinHoodHashTreeStorage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RobinHoodHashTreeStorage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename THashKey, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const RobinHoodHashTreeStorage<THashKey, TValue> & object );
+
+  } // namespace experimental
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/HashTreeStorage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HashTreeStorage_h
+
+#undef HashTreeStorage_RECURSES
+#endif // else defined(HashTreeStorage_RECURSES)
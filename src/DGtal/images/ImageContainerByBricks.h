@@ -0,0 +1,450 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testImageContainerByBricks.cpp
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBricks
+  /**
+   * Description of template class 'ImageContainerByBricks' <p>
+   * \brief Aim: Model of CImage for large and sparse images (e.g.
+   * segmented volumes which are mostly background), whose domain is
+   * cut into bricks of 2^TLogBrickSize points per side.
+   *
+   * A brick is either uniform, and stored as a single value, or
+   * allocated as a dense array of values. All the bricks are uniform
+   * at construction, with the default value, and a brick is
+   * allocated the first time a different value is written in it. The
+   * method fold() gives back the memory of the allocated bricks which
+   * became uniform. The memory is thus proportional to the number of
+   * bricks crossed by the details of the image, instead of the size
+   * of the domain (ImageContainerBySTLVector) or the number of points
+   * which are not in the background (ImageContainerBySTLMap, with a
+   * node per point).
+   *
+   * The access to a value is a division of the coordinates by
+   * shifts and masks. As a model of CImage, the values are also given
+   * by the ranges returned by constRange() and range(), in the order
+   * of the domain, so that the image can be used by
+   * ImageHelper::imageFromImage, SetFromImage or as the container of
+   * VoronoiMap. The built-in iterator (begin(), end()) visits the
+   * values brick by brick, which follows the memory, and can skip
+   * the uniform bricks.
+   *
+   * When DGtal is built with OpenMP support (WITH_OPENMP flag set to
+   * "true"), several threads can write at different points of the
+   * image (the allocations of the bricks are serialized).
+   *
+   * @code
+   typedef ImageContainerByBricks<Z3i::Domain, unsigned char, 4> Labels; //16^3 bricks
+   Labels labels( domain );
+   labels.setValue( p, 3 );
+   ...
+   for ( Labels::ConstIterator it = labels.begin(), itEnd = labels.end(); it != itEnd; )
+     if ( it.isUniform() && ( *it == 0 ) )
+       it.nextBrick();
+     else
+       { ...it.point()...; ++it; }
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue type of the values, model of CLabel.
+   * @tparam TLogBrickSize the logarithm of the number of points of a
+   * brick per side (default: 3, 8 points).
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize = 3>
+  class ImageContainerByBricks
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef ImageContainerByBricks<TDomain, TValue, TLogBrickSize> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::Space::dimension;
+    static const unsigned int logBrickSize = TLogBrickSize;
+    /// number of points of a brick per side
+    static const unsigned int brickSize = 1u << TLogBrickSize;
+    /// number of values of a brick
+    static const std::size_t brickVolume = static_cast<std::size_t>( 1 ) << ( TLogBrickSize * dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<typename Domain::Space> >::value ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /**
+     * Built-in iterator on the values, brick after brick (in the
+     * order of the grid of bricks), the points of a brick being
+     * visited in the order of the domain.
+     */
+    class BrickConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Value* pointer;
+      typedef const Value& reference;
+
+      /**
+       * Constructor.
+       * @param anImage the image.
+       * @param aBrick the index of the first brick to visit
+       * (nbBricks() for the end iterator).
+       */
+      BrickConstIterator( const Self & anImage, const std::size_t aBrick );
+
+      /**
+       * @return the value at the current point.
+       */
+      reference operator*() const;
+
+      /**
+       * @return the current point.
+       */
+      const Point & point() const;
+
+      /**
+       * @return the index of the current brick.
+       */
+      std::size_t brick() const;
+
+      /**
+       * @return 'true' if the current brick is uniform.
+       */
+      bool isUniform() const;
+
+      /**
+       * Moves to the first point of the next brick.
+       */
+      void nextBrick();
+
+      /**
+       * Moves to the next point.
+       * @return a reference on 'this'.
+       */
+      BrickConstIterator & operator++();
+
+      /**
+       * Moves to the next point.
+       * @return the iterator before the move.
+       */
+      BrickConstIterator operator++( int );
+
+      bool operator==( const BrickConstIterator & other ) const;
+      bool operator!=( const BrickConstIterator & other ) const;
+
+    private:
+      /// The image.
+      const Self * myImage;
+      /// The current brick.
+      std::size_t myBrick;
+      /// The current point.
+      Point myPoint;
+      /// The bounds of the current brick, inside the domain.
+      Point myLower, myUpper;
+      /// The values of the current brick, 0 if it is uniform.
+      const Value * myData;
+
+      /// Sets the bounds of the current brick.
+      void initBrick();
+    };
+
+    /// built-in iterators
+    typedef BrickConstIterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a domain.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the value of all the points at construction (the
+     * background).
+     */
+    ImageContainerByBricks( const Domain & aDomain, const Value & aValue = Value() );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerByBricks( const ImageContainerByBricks & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerByBricks & operator= ( const ImageContainerByBricks & other );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBricks();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point,
+     * allocating its brick if it is uniform with another value.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the values of the image, in the
+     * order of the domain.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return an iterator on the first value, brick by brick.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last value.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the number of bricks.
+     */
+    std::size_t nbBricks() const;
+
+    /**
+     * @return the number of allocated (non uniform) bricks.
+     */
+    std::size_t nbAllocatedBricks() const;
+
+    /**
+     * @param aBrick the index of a brick.
+     * @return 'true' if this brick is uniform.
+     */
+    bool isUniform( const std::size_t aBrick ) const;
+
+    /**
+     * @param aBrick the index of a brick.
+     * @return the part of the domain covered by this brick.
+     */
+    Domain brickDomain( const std::size_t aBrick ) const;
+
+    /**
+     * Frees the allocated bricks whose values are all equal, which
+     * become uniform.
+     * @return the number of freed bricks.
+     */
+    std::size_t fold();
+
+    /**
+     * @return the memory used by the values, in bytes.
+     */
+    std::size_t memory() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The image domain.
+    Domain myDomain;
+
+    /// The lower bound of the domain (origin of the bricks).
+    Point myLowerBound;
+
+    /// The number of bricks along each axis.
+    Point myGridSize;
+
+    /// The index shift of a brick along each axis.
+    std::size_t myGridStrides[ dimension ];
+
+    /// The values of the bricks, 0 for the uniform bricks.
+    std::vector<Value*> myBricks;
+
+    /// The value of each uniform brick.
+    std::vector<Value> myUniformValues;
+
+    /// The number of allocated bricks.
+    std::size_t myNbAllocatedBricks;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of its brick.
+     */
+    std::size_t brickIndex( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of its value in its brick.
+     */
+    std::size_t valueIndex( const Point & aPoint ) const;
+
+    /**
+     * Allocates a uniform brick, filled with its value.
+     * @param aBrick the index of a brick.
+     */
+    void allocateBrick( const std::size_t aBrick );
+
+    /**
+     * Copies the bricks of another image, with the same domain.
+     * @param other the image to copy.
+     */
+    void copyBricks( const ImageContainerByBricks & other );
+
+    /**
+     * Frees all the bricks.
+     */
+    void freeBricks();
+
+  }; // end of class ImageContainerByBricks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain, TValue, TLogBrickSize> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
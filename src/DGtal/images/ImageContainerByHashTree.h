@@ -42,6 +42,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -53,6 +55,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/base/Bits.h"
 #include "DGtal/images/Morton.h"
+#include "DGtal/images/HashTreeStorage.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/base/ExpressionTemplates.h"
@@ -116,28 +119,53 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * The nodes are kept by a storage policy: ChainedHashTreeStorage
+   * (default) handles the collisions with linked lists of nodes
+   * allocated one by one, whereas RobinHoodHashTreeStorage keeps the
+   * keys and the values side by side in a single open addressing
+   * array, which needs no allocation per node and is faster to
+   * iterate. The empty slots of the array may make it use a bit more
+   * memory than the chained lists (the allocator overhead of the
+   * nodes not counted). Both use much less memory than a map of the
+   * values, since uniform regions are merged, making the container a
+   * sparse volume:
+   *
+   * @code
+   typedef experimental::ImageContainerByHashTree
+     < Z3i::Domain, unsigned char, DGtal::uint64_t,
+       experimental::RobinHoodHashTreeStorage<DGtal::uint64_t, unsigned char> > SparseVolume;
+   SparseVolume volume( domain );
+   volume.fromImage( image ); //bottom-up, uniform children merged
+   * @endcode
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @taparam THashKey  type to store Morton keys
    * (default: DGtal::uint64_t)
+   * @tparam TStorage storage of the nodes, ChainedHashTreeStorage or
+   * RobinHoodHashTreeStorage of THashKey and TValue (default:
+   * ChainedHashTreeStorage).
    * 
    * @see testImageContainerByHashTree.cpp
    *       
    * */
-  template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t >
+  template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t,
+             typename TStorage = ChainedHashTreeStorage<THashKey, TValue> >
   class ImageContainerByHashTree
   {
 
-  protected:
-    class Node;
-  
- 
   public:
 
-    typedef ImageContainerByHashTree<TDomain, TValue, THashKey> Self; 
+    typedef ImageContainerByHashTree<TDomain, TValue, THashKey, TStorage> Self; 
         
     typedef THashKey HashKey;
 
+    /// storage of the nodes
+    typedef TStorage Storage;
+    BOOST_STATIC_ASSERT ((boost::is_same< typename Storage::HashKey, HashKey >::value));
+    BOOST_STATIC_ASSERT ((boost::is_same< typename Storage::Value, TValue >::value));
+    typedef typename Storage::Node Node;
+
     /// domain
     BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
     typedef TDomain Domain;
@@ -360,6 +388,39 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Replaces the content of the container by the values of a range
+     * of leaves, given in the increasing order of their keys (the
+     * Morton order, see getKey). The tree is built bottom-up, in one
+     * pass: the children of a node are merged as soon as they have
+     * the same value, so that the tree is the smallest one
+     * representing these values. The leaves which are not in the
+     * range take the value @a defaultValue.
+     *
+     * @tparam KeyValueConstIterator an iterator on std::pair<HashKey,
+     * Value>.
+     * @param first an iterator on the first leaf.
+     * @param last an iterator past the last leaf.
+     * @param defaultValue the value of the other leaves.
+     */
+    template <typename KeyValueConstIterator>
+    void fromSortedKeys(KeyValueConstIterator first, KeyValueConstIterator last,
+                        const Value defaultValue = NumberTraits<Value>::ZERO);
+
+    /**
+     * Replaces the content of the container by the values of an
+     * image, whose domain is included in the domain of the container
+     * (see fromSortedKeys).
+     *
+     * @tparam TImage a model of CConstImage.
+     * @param anImage the image.
+     * @param defaultValue the value of the points which are not in the
+     * domain of @a anImage.
+     */
+    template <typename TImage>
+    void fromImage(const TImage & anImage,
+                   const Value defaultValue = NumberTraits<Value>::ZERO);
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -403,6 +464,16 @@ namespace DGtal
       
     //stuff that might be moved out of the class for reusability
     HashKey getKey(const Point & aPoint) const;
+
+    /**
+     * Computes the keys of a range of points (see getKey).
+     * @param first an iterator on the first point.
+     * @param last an iterator past the last point.
+     * @param output an output iterator on the keys.
+     */
+    template <typename PointConstIterator, typename HashKeyOutputIterator>
+    void getKeys(PointConstIterator first, PointConstIterator last,
+                 HashKeyOutputIterator output) const;
       
     unsigned int getKeyDepth(HashKey key) const;
       
@@ -482,73 +553,24 @@ namespace DGtal
      */
     unsigned int getNbNodes()const;
 
+    /**
+     * Returns the memory used by the container and its nodes, in bytes.
+     */
+    std::size_t getMemory() const;
 
-    // -------------------------------------------------------------
-    /*  Iterator inner-class
-     *
-     *  @brief Buil-in iterator on an HashTree. This iterator visits
-     *  all node in the tree.
-     *
-     * -------------------------------------------------------------
+
+    /**
+     * Buil-in iterator on an HashTree, given by the storage. This
+     * iterator visits all node in the tree.
      */
-    class Iterator
-    {
-    public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
-      {
-        myArraySize = arraySize;
-        myContainerData = data;
-        myNode = data[0];
-        myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
-      }
-      bool isAtEnd()const
-      {
-        return myCurrentCell >= myArraySize;
-      }
-      Value& operator*()
-      {
-        return myNode->getObject();
-      }
-      bool operator ++ ()
-      {
-        return next();
-      }
-      bool operator == (const Iterator& it)
-      {
-        if (isAtEnd() && it.isAtEnd())
-          return true;
-        else
-          return (myNode == it.myNode);
-      }
-      bool operator != (const Iterator& it)
-      {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
-      }
-      inline HashKey getKey() const
-      {
-        return myNode->getKey();
-      }
-      bool next();
-    protected:
-      Node* myNode;
-      unsigned int myCurrentCell;
-      unsigned int myArraySize;
-      Node** myContainerData;
-    };
+    typedef typename Storage::Iterator Iterator;
 
     /**
      * Returns an iterator to the first value as stored in the container.
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return myData.begin();
     }
 
     /**
@@ -556,7 +578,7 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return myData.end();
     }
 
     void selfDisplay(std::ostream & out);
@@ -589,83 +611,6 @@ namespace DGtal
     recursiveDraw(HashKey key, const double p1[2], const double len, Board2D & board, const C& cmap) const;
 
 
-    // -------------------------------------------------------------
-    /**
-     * @class Node
-     *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
-     */
-    class Node
-    {
-    public:
-
-      /** 
-       * Construtctor: create pair (@a aValue, @a key)
-       * 
-       * @param aValue  First value
-       * @param key     key in the hashtree 
-       */
-      Node(Value aValue, HashKey key)
-      {
-        myData = aValue;
-        myKey = key;
-      }
-
-      /** 
-       * @return the next pair (aValue, key) in the list.
-       */
-      inline Node* getNext()
-      {
-        return myNext;
-      }
-
-
-      /** 
-       * Insert the pair (value,key)  @a next in the node list 
-       * 
-       * @param next a pointer to a pair (value,key) (Node).
-       */	
-      inline void setNext(Node* next)
-      {
-        myNext = next;
-      }
-
-      /** 
-       * 
-       * @return the key associated to a Node. 
-       */
-      inline HashKey getKey()
-      {
-        return myKey;
-      }
-	
-      /** 
-       * 
-       * @return the object (aValue) associated to a Node.
-       */
-      inline Value& getObject()
-      {
-        return myData;
-      }
-      ~Node() { }
-    protected:
-      HashKey myKey;
-      Node* myNext;
-      Value myData;
-    };// -----------------------------------------------------------
-
-
-    /**
-     * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
-     *
-     * @param key a node in the hashtree.
-     */
-    inline HashKey getIntermediateKey(const HashKey key) const;
-
-
     /**
      * Add a Node to the tree.  This method is very used when writing
      * in the tree (set method). As detailed in the inner class
@@ -677,18 +622,7 @@ namespace DGtal
      */
     Node* addNode(const Value object, const HashKey key)
     {
-      Node* n = getNode(key);
-      if (n)
-        {
-          n->getObject() = object;
-          //n->setObject(object);
-          return n;
-        }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
+      return myData.insert(key, object);
     }
 
   public:
@@ -701,14 +635,7 @@ namespace DGtal
      */
     inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
-        {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
-        }
-      return 0;
+      return myData.find(key);
     }
   protected:
 
@@ -743,6 +670,35 @@ namespace DGtal
      */
     Value blendChildren(HashKey key) const;
 
+    /**
+     * Builds bottom-up the sub-tree of a key from the leaves of a
+     * sorted range, the nodes being appended to @a nodes (see
+     * fromSortedKeys).
+     * @param key the root of the sub-tree.
+     * @param level the depth of @a key.
+     * @param first (modified) an iterator on the first leaf of the
+     * range which is not before the sub-tree, moved after its leaves.
+     * @param last an iterator past the last leaf.
+     * @param defaultValue the value of the leaves which are not in
+     * the range.
+     * @param nodes (modified) the nodes of the tree.
+     * @param value (returns) the value of the sub-tree if it is uniform.
+     * @return 'true' if the sub-tree is uniform, its node being not
+     * appended to @a nodes.
+     */
+    template <typename KeyValueConstIterator>
+    bool buildSubTree(const HashKey key, const unsigned int level,
+                      KeyValueConstIterator & first, const KeyValueConstIterator & last,
+                      const Value & defaultValue,
+                      std::vector< std::pair<HashKey, Value> > & nodes,
+                      Value & value) const;
+
+    /**
+     * @return 'true' if the key of @a a is smaller than the one of @a b.
+     */
+    static bool keyLess(const std::pair<HashKey, Value> & a,
+                        const std::pair<HashKey, Value> & b);
+
 
     //----------------------- internal data --------------------------------
   protected: 
@@ -753,9 +709,9 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The storage of the nodes, containing all the data
      */
-    Node** myData;
+    Storage myData;
 
     /**
      * The size of the intermediate hashkey. The bigger the less
@@ -764,8 +720,6 @@ namespace DGtal
      */
     unsigned int myKeySize;
 
-    unsigned int myArraySize;
-
     /**
      * The depth of the tree
      */
@@ -786,7 +740,6 @@ namespace DGtal
      * Precoputed masks to avoid recalculating it all the time
      */
     HashKey myDepthMask;
-    HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
 
   public:
     ///The morton code computer.
@@ -801,9 +754,9 @@ namespace DGtal
    * @param object the object of class 'ImageContainerByHashTree' to write.
    * @return the output stream after the writing.
    */
-  template<typename TDomain, typename TValue, typename THashKey >
+  template<typename TDomain, typename TValue, typename THashKey, typename TStorage >
   std::ostream&
-  operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey> & object )
+  operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey, TStorage> & object )
   {
     object.selfDisplay( out);
     return out;
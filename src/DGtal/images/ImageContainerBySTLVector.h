@@ -510,6 +510,56 @@ namespace DGtal
     };
 
 
+    /////////////////////////// Row traversal ///////////////
+    // Values along the first dimension are contiguous in the
+    // container, so the image can be scanned as a sequence of rows
+    // given by [begin,end) pointer pairs. Rows are numbered in the
+    // domain order, the first point of row @a i being rowPoint(i).
+    // Not available when Value is bool (std::vector<bool> is packed).
+
+    /**
+     * @return the number of rows (scanlines along the first
+     * dimension) of the image.
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of values in each row, i.e. the extent of
+     * the domain along the first dimension.
+     */
+    Size rowLength() const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return the first point of the row @a aRow.
+     */
+    Point rowPoint ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a pointer on the first value of the row @a aRow.
+     */
+    const Value* rowBegin ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a pointer past the last value of the row @a aRow.
+     */
+    const Value* rowEnd ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a mutable pointer on the first value of the row @a aRow.
+     */
+    Value* rowBegin ( const Size aRow );
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a mutable pointer past the last value of the row @a aRow.
+     */
+    Value* rowEnd ( const Size aRow );
+
+
 
 
     /**
@@ -523,6 +573,33 @@ namespace DGtal
 
   };
 
+  namespace details
+  {
+    /**
+     * Tells at compile time whether an image type provides the row
+     * traversal services of ImageContainerBySTLVector (nbRows(),
+     * rowPoint(), rowBegin(), rowEnd()). Generic algorithms use it to
+     * select a scanline fast path instead of a domain scan.
+     */
+    template <typename TImage>
+    struct HasContiguousRows
+    {
+      static const bool value = false;
+    };
+
+    template <typename TDomain, typename TValue>
+    struct HasContiguousRows< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      static const bool value = true;
+    };
+
+    template <typename TDomain>
+    struct HasContiguousRows< ImageContainerBySTLVector<TDomain, bool> >
+    {
+      static const bool value = false;
+    };
+  } // namespace details
+
   /**
    * Overloads 'operator<<' for displaying objects of class 'Image'.
    * @param out the output stream where the object is written.
@@ -46,6 +46,7 @@
 #include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageContainerByBricks.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,6 +55,7 @@ namespace DGtal
   enum ImageIterability {  HIGH_ITER_IMAGE = 0 , LOW_ITER_I = 1};
   enum ImageBelongTestability {  HIGH_BEL_I = 0, LOW_BEL_I = 2 };
   enum ImageSpecificContainer { NORMAL_CONTAINER_I = 0, VTKIMAGEDATA_CONTAINER_I = 4 };
+  enum ImageSparsity { DENSE_I = 0, SPARSE_I = 8 };
 
   /////////////////////////////////////////////////////////////////////////////
   // template class ImageSelector
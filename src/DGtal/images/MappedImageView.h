@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MappedImageView.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module MappedImageView.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MappedImageView_RECURSES)
+#error Recursive header files inclusion detected in MappedImageView.h
+#else // defined(MappedImageView_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MappedImageView_RECURSES
+
+#if !defined MappedImageView_h
+/** Prevents repeated inclusion of headers. */
+#define MappedImageView_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits/alignment_of.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/MappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MappedImageView
+  /**
+   * Description of template class 'MappedImageView' <p>
+   * \brief Aim: Model of CConstImage and CImage whose values are read in place in a memory-mapped file
+   * (see MappedFile).
+   *
+   * The values are stored in the file from a given offset, with the
+   * same linearization as ImageContainerBySTLVector (first dimension
+   * first) and in the byte order of the host. Opening a view reads
+   * nothing: pages of the file are loaded on demand when values are
+   * accessed, and released by the system under memory pressure.
+   *
+   * Copies of a view share the mapping, which is closed when the last
+   * view is destroyed. When the values are not suitably aligned in the
+   * mapping (e.g. 64 bits values after a text header), a read-only
+   * view copies them into a buffer; isMapped() tells which case
+   * occurs.
+   *
+   * As ImageContainerBySTLVector, the view provides row traversal
+   * services (nbRows(), rowPoint(), rowBegin(), rowEnd()).
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue a model of CLabel, trivially copyable.
+   *
+   * @see VolReader::mapVol, RawReader::mapRaw8, LongvolReader::mapLongvol
+   * @see VolWriter::createMappedVol, RawWriter::createMappedRaw8
+   * @see testMappedImageView.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class MappedImageView
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef MappedImageView<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain<SpaceND<dimension, Integer> > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( CLabel<TValue> ) );
+    typedef TValue Value;
+
+    typedef const Value* ConstIterator;
+    typedef Value* Iterator;
+    typedef Value* OutputIterator;
+    typedef std::ptrdiff_t Difference;
+
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator, DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator, Iterator, DistanceFunctorFromPoint<Self> > Range;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the image domain.
+     * @param aFile an opened file, holding at least
+     * aDomain.size() values from @a anOffset.
+     * @param anOffset the position of the first value in the file (in bytes).
+     *
+     * Throws IOException if the file is too small, or if it is
+     * writable and the values are not aligned in the mapping.
+     */
+    MappedImageView( const Domain & aDomain,
+                     const CountedPtr<MappedFile> & aFile,
+                     const MappedFile::Size anOffset );
+
+    /**
+     * Destructor. The mapping is closed with the last view using it.
+     */
+    ~MappedImageView();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of the image at a given position.
+     * @pre the point must be in the domain.
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value of the image, written through to the file.
+     * @pre the point must be in the domain.
+     * @param aPoint the point.
+     * @param aValue the value.
+     * @throw IOException if the view is not writable.
+     */
+    void setValue ( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the range of the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the mutable range of the values of the image.
+     * @throw IOException if the view is not writable.
+     */
+    Range range();
+
+    /**
+     * @return 'true' if the values are read in place in the mapping,
+     * 'false' if they have been copied into a buffer.
+     */
+    bool isMapped() const;
+
+    /**
+     * @return 'true' if the values can be modified (and are then
+     * written to the file).
+     */
+    bool isWritable() const;
+
+    /**
+     * Writes back the modified values to the file (also done when
+     * the mapping is closed).
+     */
+    void flush();
+
+    /**
+     * Linearized a point and return its position in the values.
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the values.
+     */
+    Size linearized ( const Point & aPoint ) const;
+
+    // ----------------------- Row traversal --------------------------------------
+
+    /**
+     * @return the number of rows (scanlines along the first
+     * dimension) of the image.
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of values in each row.
+     */
+    Size rowLength() const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return the first point of the row @a aRow.
+     */
+    Point rowPoint ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a pointer on the first value of the row @a aRow.
+     */
+    const Value* rowBegin ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a pointer past the last value of the row @a aRow.
+     */
+    const Value* rowEnd ( const Size aRow ) const;
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a mutable pointer on the first value of the row @a aRow.
+     * @throw IOException if the view is not writable.
+     */
+    Value* rowBegin ( const Size aRow );
+
+    /**
+     * @param aRow a row index in [0,nbRows()).
+     * @return a mutable pointer past the last value of the row @a aRow.
+     * @throw IOException if the view is not writable.
+     */
+    Value* rowEnd ( const Size aRow );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Image domain.
+    Domain myDomain;
+    /// Domain extent (stored for linearization efficiency).
+    Vector myExtent;
+    /// The mapped file.
+    CountedPtr<MappedFile> myFile;
+    /// Values copied from the file when they are not aligned in the mapping.
+    CountedPtr< std::vector<Value> > myBuffer;
+    /// First value of the image.
+    Value* myValues;
+    /// Tells if the values may be modified.
+    bool myIsWritable;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Throws an IOException if the view is not writable: the pages of
+     * a read-only mapping cannot be modified.
+     */
+    void checkWritable() const;
+
+  }; // end of class MappedImageView
+
+  namespace details
+  {
+    template <typename TDomain, typename TValue>
+    struct HasContiguousRows< MappedImageView<TDomain, TValue> >
+    {
+      static const bool value = true;
+    };
+  } // namespace details
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MappedImageView'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MappedImageView' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const MappedImageView<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/MappedImageView.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MappedImageView_h
+
+#undef MappedImageView_RECURSES
+#endif // else defined(MappedImageView_RECURSES)
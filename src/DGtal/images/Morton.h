@@ -49,11 +49,195 @@
 #include "DGtal/kernel/CInteger.h"
 
 #include "DGtal/base/Bits.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+/// The PDEP/PEXT instructions (BMI2) may be used by Morton, if the
+/// processor supports them.
+#define DGTAL_MORTON_BMI2
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  namespace details
+  {
+    /**
+     * Description of template class 'MortonDilation' <p>
+     * @brief Aim: Spreads the bits of an integer for the Morton code
+     * construction, so that the bit @a i of the input becomes the bit
+     * @a i * dim of the output (dilation), and conversely
+     * (contraction). Only the first nbBits / dim bits are kept.
+     *
+     * This generic version reads the bits one by one. It is
+     * specialized with the classical magic number sequences (shifts
+     * and masks) for 32 and 64 bit keys in dimensions 2 and 3.
+     *
+     * @tparam HashKey type of the Morton codes.
+     * @tparam dim the dimension.
+     * @tparam nbBits the number of bits of HashKey.
+     */
+    template <typename HashKey, Dimension dim, unsigned int nbBits>
+    struct MortonDilation
+    {
+      /// 'true' if the magic number specializations are used
+      static const bool isFast = false;
+
+      /// Mask of the bits of the first coordinate in a code
+      static HashKey mask()
+      {
+        return dilate( ~static_cast<HashKey>( 0 ) );
+      }
+
+      static HashKey dilate( const HashKey x )
+      {
+        HashKey output = 0;
+        for ( unsigned int i = 0; i < nbBits / dim; ++i )
+          if ( x & ( static_cast<HashKey>( 1 ) << i ) )
+            output |= static_cast<HashKey>( 1 ) << ( i * dim );
+        return output;
+      }
+
+      static HashKey contract( const HashKey x )
+      {
+        HashKey output = 0;
+        for ( unsigned int i = 0; i < nbBits / dim; ++i )
+          if ( x & ( static_cast<HashKey>( 1 ) << ( i * dim ) ) )
+            output |= static_cast<HashKey>( 1 ) << i;
+        return output;
+      }
+    };
+
+    template <typename HashKey>
+    struct MortonDilation<HashKey, 2, 32>
+    {
+      static const bool isFast = true;
+      static HashKey mask() { return 0x55555555u; }
+      static HashKey dilate( const HashKey key )
+      {
+        DGtal::uint32_t x = static_cast<DGtal::uint32_t>( key ) & 0x0000ffffu;
+        x = ( x | ( x << 8 ) ) & 0x00ff00ffu;
+        x = ( x | ( x << 4 ) ) & 0x0f0f0f0fu;
+        x = ( x | ( x << 2 ) ) & 0x33333333u;
+        x = ( x | ( x << 1 ) ) & 0x55555555u;
+        return static_cast<HashKey>( x );
+      }
+      static HashKey contract( const HashKey key )
+      {
+        DGtal::uint32_t x = static_cast<DGtal::uint32_t>( key ) & 0x55555555u;
+        x = ( x | ( x >> 1 ) ) & 0x33333333u;
+        x = ( x | ( x >> 2 ) ) & 0x0f0f0f0fu;
+        x = ( x | ( x >> 4 ) ) & 0x00ff00ffu;
+        x = ( x | ( x >> 8 ) ) & 0x0000ffffu;
+        return static_cast<HashKey>( x );
+      }
+    };
+
+    template <typename HashKey>
+    struct MortonDilation<HashKey, 2, 64>
+    {
+      static const bool isFast = true;
+      static HashKey mask() { return 0x5555555555555555ull; }
+      static HashKey dilate( const HashKey key )
+      {
+        DGtal::uint64_t x = static_cast<DGtal::uint64_t>( key ) & 0x00000000ffffffffull;
+        x = ( x | ( x << 16 ) ) & 0x0000ffff0000ffffull;
+        x = ( x | ( x << 8 ) ) & 0x00ff00ff00ff00ffull;
+        x = ( x | ( x << 4 ) ) & 0x0f0f0f0f0f0f0f0full;
+        x = ( x | ( x << 2 ) ) & 0x3333333333333333ull;
+        x = ( x | ( x << 1 ) ) & 0x5555555555555555ull;
+        return static_cast<HashKey>( x );
+      }
+      static HashKey contract( const HashKey key )
+      {
+        DGtal::uint64_t x = static_cast<DGtal::uint64_t>( key ) & 0x5555555555555555ull;
+        x = ( x | ( x >> 1 ) ) & 0x3333333333333333ull;
+        x = ( x | ( x >> 2 ) ) & 0x0f0f0f0f0f0f0f0full;
+        x = ( x | ( x >> 4 ) ) & 0x00ff00ff00ff00ffull;
+        x = ( x | ( x >> 8 ) ) & 0x0000ffff0000ffffull;
+        x = ( x | ( x >> 16 ) ) & 0x00000000ffffffffull;
+        return static_cast<HashKey>( x );
+      }
+    };
+
+    template <typename HashKey>
+    struct MortonDilation<HashKey, 3, 32>
+    {
+      static const bool isFast = true;
+      static HashKey mask() { return 0x09249249u; }
+      static HashKey dilate( const HashKey key )
+      {
+        DGtal::uint32_t x = static_cast<DGtal::uint32_t>( key ) & 0x000003ffu;
+        x = ( x | ( x << 16 ) ) & 0x030000ffu;
+        x = ( x | ( x << 8 ) ) & 0x0300f00fu;
+        x = ( x | ( x << 4 ) ) & 0x030c30c3u;
+        x = ( x | ( x << 2 ) ) & 0x09249249u;
+        return static_cast<HashKey>( x );
+      }
+      static HashKey contract( const HashKey key )
+      {
+        DGtal::uint32_t x = static_cast<DGtal::uint32_t>( key ) & 0x09249249u;
+        x = ( x | ( x >> 2 ) ) & 0x030c30c3u;
+        x = ( x | ( x >> 4 ) ) & 0x0300f00fu;
+        x = ( x | ( x >> 8 ) ) & 0x030000ffu;
+        x = ( x | ( x >> 16 ) ) & 0x000003ffu;
+        return static_cast<HashKey>( x );
+      }
+    };
+
+    template <typename HashKey>
+    struct MortonDilation<HashKey, 3, 64>
+    {
+      static const bool isFast = true;
+      static HashKey mask() { return 0x1249249249249249ull; }
+      static HashKey dilate( const HashKey key )
+      {
+        DGtal::uint64_t x = static_cast<DGtal::uint64_t>( key ) & 0x00000000001fffffull;
+        x = ( x | ( x << 32 ) ) & 0x001f00000000ffffull;
+        x = ( x | ( x << 16 ) ) & 0x001f0000ff0000ffull;
+        x = ( x | ( x << 8 ) ) & 0x100f00f00f00f00full;
+        x = ( x | ( x << 4 ) ) & 0x10c30c30c30c30c3ull;
+        x = ( x | ( x << 2 ) ) & 0x1249249249249249ull;
+        return static_cast<HashKey>( x );
+      }
+      static HashKey contract( const HashKey key )
+      {
+        DGtal::uint64_t x = static_cast<DGtal::uint64_t>( key ) & 0x1249249249249249ull;
+        x = ( x | ( x >> 2 ) ) & 0x10c30c30c30c30c3ull;
+        x = ( x | ( x >> 4 ) ) & 0x100f00f00f00f00full;
+        x = ( x | ( x >> 8 ) ) & 0x001f0000ff0000ffull;
+        x = ( x | ( x >> 16 ) ) & 0x001f00000000ffffull;
+        x = ( x | ( x >> 32 ) ) & 0x00000000001fffffull;
+        return static_cast<HashKey>( x );
+      }
+    };
+
+#ifdef DGTAL_MORTON_BMI2
+    /**
+     * PDEP/PEXT instructions, compiled for the processors supporting
+     * BMI2 only (runtime dispatch, see Morton::useBMI2).
+     */
+    struct MortonBMI2
+    {
+      static bool isSupported()
+      {
+        return __builtin_cpu_supports( "bmi2" );
+      }
+      __attribute__(( target( "bmi2" ) ))
+      static DGtal::uint64_t deposit( const DGtal::uint64_t x, const DGtal::uint64_t mask )
+      {
+        return _pdep_u64( x, mask );
+      }
+      __attribute__(( target( "bmi2" ) ))
+      static DGtal::uint64_t extract( const DGtal::uint64_t x, const DGtal::uint64_t mask )
+      {
+        return _pext_u64( x, mask );
+      }
+    };
+#endif
+  } // namespace details
+
   /////////////////////////////////////////////////////////////////////////////
   // template class Morton
   /**
@@ -67,6 +251,14 @@ namespace DGtal
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
    *
+   * For 32 and 64 bit keys in dimensions 2 and 3, the bits are
+   * spread with magic number sequences (see details::MortonDilation)
+   * or, on demand (see useBMI2) on x86-64 processors supporting the
+   * BMI2 instruction set, with the PDEP/PEXT instructions. These
+   * instructions are not the default since they are microcoded, and
+   * much slower than the magic numbers, on some processors (AMD
+   * before Zen 3). The other cases read the bits one by one.
+   *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
    * @tparam TPoint type of points. 
@@ -86,11 +278,24 @@ namespace DGtal
     BOOST_CONCEPT_ASSERT(( CIntegralNumber<THashKey> ));
     BOOST_CONCEPT_ASSERT(( CInteger<Coordinate> ));
 
+    /// Dilation of the coordinates
+    typedef details::MortonDilation<HashKey, dimension, sizeof( HashKey ) * 8> Dilation;
+
     /**
      * Constructor
      *
      */
     Morton();
+
+    /**
+     * Enables or disables the PDEP/PEXT instructions for the
+     * computation of the codes (disabled by default). They are only
+     * used if the processor supports them.
+     *
+     * @param flag 'true' to use them when possible.
+     * @return 'true' if they are used.
+     */
+    bool useBMI2( const bool flag );
     
     /**
      * Interleave the bits of the nbIn inputs.
@@ -99,6 +304,20 @@ namespace DGtal
      */ 
     void interleaveBits(const Point  & aPoint, HashKey & output) const;
 
+    /**
+     * Interleave the bits of the coordinates of a range of points
+     * (see interleaveBits).
+     *
+     * @tparam PointConstIterator a model of input iterator on Point.
+     * @tparam HashKeyOutputIterator a model of output iterator on HashKey.
+     * @param first the first point of the range.
+     * @param last the point after the last point of the range.
+     * @param output the output iterator of the results.
+     */
+    template <typename PointConstIterator, typename HashKeyOutputIterator>
+    void interleaveBits(PointConstIterator first, PointConstIterator last,
+                        HashKeyOutputIterator output) const;
+
 
     /**
      * Returns the key corresponding to the coordinates passed in the parameters.
@@ -111,6 +330,22 @@ namespace DGtal
      */
     HashKey keyFromCoordinates(const std::size_t treeDepth, const Point & coordinates) const;
 
+    /**
+     * Computes the keys of a range of points (see keyFromCoordinates).
+     *
+     * @tparam PointConstIterator a model of input iterator on Point.
+     * @tparam HashKeyOutputIterator a model of output iterator on HashKey.
+     * @param treeDepth The depth at which the coordinates are to be
+     * read.
+     * @param first the first point of the range.
+     * @param last the point after the last point of the range.
+     * @param output the output iterator of the keys.
+     */
+    template <typename PointConstIterator, typename HashKeyOutputIterator>
+    void keysFromCoordinates(const std::size_t treeDepth,
+                             PointConstIterator first, PointConstIterator last,
+                             HashKeyOutputIterator output) const;
+
     /**
      * Computes the coordinates correspponding to a key.
      *
@@ -148,10 +383,9 @@ namespace DGtal
     void childrenKeys(const HashKey key, HashKey* result ) const;
     
   private: 
-    
-    ///@todo Implements dilateMasks
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
+
+    /// 'true' if the PDEP/PEXT instructions are used.
+    bool myBMI2;
   };
 } // namespace DGtal
 
@@ -87,20 +87,16 @@ namespace DGtal
     
     /** 
      * @return True if the point belongs to the value interval.
+     *
+     * The mutable iterators of the ranges of the images, when they are
+     * convertible into constant iterators, are also accepted (the
+     * ranges of the images do not all define a mutable iterator type).
      */
     bool operator()(const typename Image::ConstRange::ConstIterator &it) const
     {
       return ((*it) > myMinVal) && ((*it) <= myMaxVal);
     }
 
-    /**
-     * @return True if the point belongs to the value interval.
-     */
-    bool operator()(const typename Image::Range::Iterator &it) const
-    {
-      return ((*it) > myMinVal) && ((*it) <= myMaxVal);
-    }
-
   private:
     CountedPtr<Image> myImage;
     Value myMaxVal;
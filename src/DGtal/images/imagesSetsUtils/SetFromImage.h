@@ -41,9 +41,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <boost/type_traits/integral_constant.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/imagesSetsUtils/IntervalForegroundPredicate.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -143,6 +145,8 @@ namespace DGtal
      * @param minVal minimum value of the thresholding
      * @param maxVal maximum value of the thresholding
      *
+     * Images with contiguous rows (see
+     * ImageContainerBySTLVector::rowBegin) are scanned row by row.
      */
     template<typename Image>
     static
@@ -150,10 +154,35 @@ namespace DGtal
 		const typename Image::Value minVal,
 		const typename Image::Value maxVal)
     {
-      IntervalForegroundPredicate<Image> isForeground(aImage,minVal,maxVal);
-      append(aSet,aImage,isForeground);
+      appendInterval(aSet, aImage, minVal, maxVal,
+                     boost::integral_constant<bool,
+                     details::HasContiguousRows<Image>::value>());
     }
 
+  private:
+
+    /** 
+     * Generic version of append(aSet,aImage,minVal,maxVal): scans the
+     * image domain.
+     */
+    template<typename Image>
+    static
+    void appendInterval(Set &aSet, const Image &aImage, 
+                        const typename Image::Value minVal,
+                        const typename Image::Value maxVal,
+                        boost::false_type);
+
+    /** 
+     * Row-based version of append(aSet,aImage,minVal,maxVal): scans
+     * the values of each row of the image storage.
+     */
+    template<typename Image>
+    static
+    void appendInterval(Set &aSet, const Image &aImage, 
+                        const typename Image::Value minVal,
+                        const typename Image::Value maxVal,
+                        boost::true_type);
+
   };
 } // namespace DGtal
 
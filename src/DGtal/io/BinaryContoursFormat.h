@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContoursFormat.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file describing the binary contours format shared by
+ * BinaryContoursWriter and BinaryContoursReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContoursFormat_RECURSES)
+#error Recursive header files inclusion detected in BinaryContoursFormat.h
+#else // defined(BinaryContoursFormat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContoursFormat_RECURSES
+
+#if !defined BinaryContoursFormat_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContoursFormat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct BinaryContoursFormat
+  /**
+   * Description of struct 'BinaryContoursFormat' <p>
+   * \brief Aim: Describes a compact binary file format storing a
+   * sequence of contours, either as sequences of digital points or as
+   * 4-connected Freeman chains.
+   *
+   * A file is made of:
+   * - a Header (40 bytes),
+   * - the records of the contours, each one starting on a multiple of
+   *   8 bytes:
+   *   - for kind POINTS: the coordinates of the points as int32
+   *     (dimension values per point),
+   *   - for kind FREEMAN_CHAINS: the first point x0, y0 as int32,
+   *     followed by the codes packed 4 per byte (2 bits per move,
+   *     the i-th code in bits 2*(i%4) and 2*(i%4)+1 of byte i/4),
+   * - the index: one IndexEntry per contour, giving the offset of its
+   *   record from the beginning of the file and its number of points
+   *   (resp. codes). The header gives the offset of the index.
+   *
+   * All values are written in the byte order of the host, which is
+   * recorded in the header so that a reader can reject a file
+   * written on a host with a different byte order. Such a file can
+   * thus be memory-mapped and its contours used in place.
+   *
+   * @see BinaryContoursWriter, BinaryContoursReader
+   */
+  struct BinaryContoursFormat
+  {
+    /// The kinds of contours stored in a file.
+    enum Kind { POINTS = 0, FREEMAN_CHAINS = 1 };
+
+    /// The header at the beginning of the file.
+    struct Header
+    {
+      /// Always "DGtalBC" followed by a null character.
+      char magic[ 8 ];
+      /// Always BYTE_ORDER_MARK in the byte order of the writer.
+      DGtal::uint32_t byteOrderMark;
+      /// The version of the format.
+      DGtal::uint32_t version;
+      /// The kind of contours (a Kind value).
+      DGtal::uint32_t kind;
+      /// The dimension of the points (2 for Freeman chains).
+      DGtal::uint32_t dimension;
+      /// The number of contours.
+      DGtal::uint64_t nbContours;
+      /// The offset of the index from the beginning of the file.
+      DGtal::uint64_t indexOffset;
+    };
+
+    /// An entry of the index, one per contour.
+    struct IndexEntry
+    {
+      /// The offset of the record from the beginning of the file.
+      DGtal::uint64_t offset;
+      /// The number of points or Freeman codes of the contour.
+      DGtal::uint64_t nbElements;
+    };
+
+    /// Value of Header::byteOrderMark.
+    static const DGtal::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    /// Current value of Header::version.
+    static const DGtal::uint32_t VERSION = 1;
+
+    /**
+     * @return the magic string of the format (8 bytes including the
+     * terminating null character).
+     */
+    static const char* magic()
+    {
+      return "DGtalBC";
+    }
+
+    /**
+     * @param size any number of bytes.
+     * @return the smallest multiple of 8 greater or equal to [size].
+     */
+    static DGtal::uint64_t alignedSize( DGtal::uint64_t size )
+    {
+      return ( size + 7 ) & ~( (DGtal::uint64_t) 7 );
+    }
+
+    /**
+     * @param nbCodes a number of Freeman codes.
+     * @return the size in bytes of a Freeman chain record, without
+     * alignment.
+     */
+    static DGtal::uint64_t freemanChainSize( DGtal::uint64_t nbCodes )
+    {
+      return 2 * sizeof( DGtal::int32_t ) + ( nbCodes + 3 ) / 4;
+    }
+  };
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContoursFormat_h
+
+#undef BinaryContoursFormat_RECURSES
+#endif // else defined(BinaryContoursFormat_RECURSES)
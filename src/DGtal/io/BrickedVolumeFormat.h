@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickedVolumeFormat.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file describing the chunked and compressed volume format
+ * shared by BrickedVolumeWriter and BrickedVolumeReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickedVolumeFormat_RECURSES)
+#error Recursive header files inclusion detected in BrickedVolumeFormat.h
+#else // defined(BrickedVolumeFormat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickedVolumeFormat_RECURSES
+
+#if !defined BrickedVolumeFormat_h
+/** Prevents repeated inclusion of headers. */
+#define BrickedVolumeFormat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct BrickedVolumeFormat
+  /**
+   * Description of struct 'BrickedVolumeFormat' <p>
+   * \brief Aim: Describes a chunked and compressed file format for 3D
+   * volumes, whose bricks can be read independently.
+   *
+   * The volume [0,X-1]x[0,Y-1]x[0,Z-1] is cut into cubic bricks of
+   * side 2^logBrickSize (the bricks on the upper faces are clipped to
+   * the volume). Bricks are numbered x first, then y, then z, and the
+   * values of a brick are stored x first, then y, then z in the brick.
+   *
+   * A file is made of:
+   * - a Header (56 bytes),
+   * - the records of the bricks, each one starting on a multiple of
+   *   8 bytes and compressed independently with one of the codecs:
+   *   - RAW: the values as is,
+   *   - UNIFORM: the brick holds a single value, stored once,
+   *   - LZ: a byte oriented LZ77 code (see compress()),
+   * - the index: one IndexEntry per brick, giving the offset, size
+   *   and codec of its record. The header gives the offset of the
+   *   index.
+   *
+   * Header, index and values are written in the byte order of the
+   * host, recorded in the header so that a reader can reject a file
+   * written on a host with a different byte order.
+   *
+   * The codecs are implemented here without any dependency.
+   *
+   * @see BrickedVolumeWriter, BrickedVolumeReader
+   */
+  struct BrickedVolumeFormat
+  {
+    /// The codecs of the brick records.
+    enum Codec { RAW = 0, UNIFORM = 1, LZ = 2 };
+
+    /// The header at the beginning of the file.
+    struct Header
+    {
+      /// Always "DGtalBV" followed by a null character.
+      char magic[ 8 ];
+      /// Always BYTE_ORDER_MARK in the byte order of the writer.
+      DGtal::uint32_t byteOrderMark;
+      /// The version of the format.
+      DGtal::uint32_t version;
+      /// The size in bytes of a value.
+      DGtal::uint32_t valueSize;
+      /// The log2 of the side of the bricks.
+      DGtal::uint32_t logBrickSize;
+      /// The size of the volume along x, y and z.
+      DGtal::uint32_t extent[ 3 ];
+      /// Unused, always 0.
+      DGtal::uint32_t reserved;
+      /// The number of bricks.
+      DGtal::uint64_t nbBricks;
+      /// The offset of the index from the beginning of the file.
+      DGtal::uint64_t indexOffset;
+    };
+
+    /// An entry of the index, one per brick.
+    struct IndexEntry
+    {
+      /// The offset of the record from the beginning of the file.
+      DGtal::uint64_t offset;
+      /// The size in bytes of the record.
+      DGtal::uint32_t size;
+      /// The codec of the record (a Codec value).
+      DGtal::uint32_t codec;
+    };
+
+    /// Value of Header::byteOrderMark.
+    static const DGtal::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    /// Current value of Header::version.
+    static const DGtal::uint32_t VERSION = 1;
+    /// Largest accepted logBrickSize (bricks of 256^3 values, so that
+    /// the size of a record fits in IndexEntry::size).
+    static const DGtal::uint32_t MAX_LOG_BRICK_SIZE = 8;
+
+    /**
+     * @return the magic string of the format (8 bytes including the
+     * terminating null character).
+     */
+    static const char* magic()
+    {
+      return "DGtalBV";
+    }
+
+    /**
+     * @param size any number of bytes.
+     * @return the smallest multiple of 8 greater or equal to [size].
+     */
+    static DGtal::uint64_t alignedSize( DGtal::uint64_t size )
+    {
+      return ( size + 7 ) & ~( (DGtal::uint64_t) 7 );
+    }
+
+    /**
+     * @param extent the size of the volume along an axis.
+     * @param logBrickSize the log2 of the side of the bricks.
+     * @return the number of bricks along this axis.
+     */
+    static DGtal::uint32_t nbBricksAlong( DGtal::uint32_t extent,
+                                          DGtal::uint32_t logBrickSize )
+    {
+      return ( extent + ( 1u << logBrickSize ) - 1 ) >> logBrickSize;
+    }
+
+    /**
+     * Encodes [n] bytes with the codec LZ and appends the code to
+     * [out]. The code is a sequence of blocks made of:
+     * - a token byte, whose 4 high bits give the number of literals
+     *   and the 4 low bits the length of the match minus 4 (15 means
+     *   that the length continues with extra bytes, each one added,
+     *   up to a byte different from 255),
+     * - the literal bytes,
+     * - the distance of the match (2 bytes, little-endian) and the
+     *   extra bytes of its length.
+     * The last block only has literals. Matches may overlap the bytes
+     * they produce, so that runs of a repeated value are coded with a
+     * few bytes.
+     *
+     * @param src the bytes to encode.
+     * @param n the number of bytes.
+     * @param out the vector where the code is appended.
+     */
+    static void compress( const char* src, std::size_t n, std::vector<char> & out );
+
+    /**
+     * Decodes a code produced by compress().
+     *
+     * @param src the code.
+     * @param n the size in bytes of the code.
+     * @param dst (returns) the decoded bytes.
+     * @param m the number of bytes to decode.
+     * @return 'true' if the code is valid and decodes exactly [m] bytes.
+     */
+    static bool decompress( const char* src, std::size_t n, char* dst, std::size_t m );
+
+    /**
+     * Encodes the values of a brick with the best codec.
+     *
+     * @param src the values of the brick.
+     * @param nbValues the number of values.
+     * @param valueSize the size in bytes of a value.
+     * @param out (returns) the record of the brick.
+     * @return the codec used.
+     */
+    static Codec encodeBrick( const char* src, std::size_t nbValues,
+                              std::size_t valueSize, std::vector<char> & out );
+
+    /**
+     * Decodes the record of a brick.
+     *
+     * @param codec the codec of the record.
+     * @param src the record.
+     * @param n the size in bytes of the record.
+     * @param dst (returns) the values of the brick.
+     * @param nbValues the number of values of the brick.
+     * @param valueSize the size in bytes of a value.
+     * @return 'true' if the record is valid.
+     */
+    static bool decodeBrick( Codec codec, const char* src, std::size_t n,
+                             char* dst, std::size_t nbValues, std::size_t valueSize );
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BrickedVolumeFormat.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickedVolumeFormat_h
+
+#undef BrickedVolumeFormat_RECURSES
+#endif // else defined(BrickedVolumeFormat_RECURSES)
@@ -55,6 +55,7 @@
 #include "DGtal/geometry/curves/GeometricalDSS.h"
 #include "DGtal/geometry/curves/GeometricalDCA.h"
 #include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -179,6 +180,11 @@ template <typename TIterator, typename TInteger>
 static  void draw(DGtal::Board2D & aBoard, const DGtal::FrechetShortcut<TIterator,TInteger> & );
 //FrechetShortcut
 
+//FlatFrechetShortcut
+template <typename TIterator, typename TInteger>
+static  void draw(DGtal::Board2D & aBoard, const DGtal::FlatFrechetShortcut<TIterator,TInteger> & );
+//FlatFrechetShortcut
+
 
    
 
@@ -251,18 +257,18 @@ static void draw( DGtal::Board2D & board, const DGtal::HyperRectDomain<TSpace> &
     
     
 // ImageContainerByHashTree
-template <typename C, typename Domain, typename Value, typename HashKey>
+template <typename C, typename Domain, typename Value, typename HashKey, typename Storage>
 static void drawImageRecursive( DGtal::Board2D & aBoard, 
-                         const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> & i,
+                         const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey, Storage> & i,
                          HashKey key,
                          const double p[2],
                          const double len,
                          LibBoard::Board & board,
                          const C& cmap );
 
-template <typename C, typename Domain, typename Value, typename HashKey>
+template <typename C, typename Domain, typename Value, typename HashKey, typename Storage>
 static void drawImageHashTree( Board2D & board,
-                const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> &,
+                const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey, Storage> &,
                 const Value &, const Value & );
 // ImageContainerByHashTree
 
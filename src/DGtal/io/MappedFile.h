@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MappedFile.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module MappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MappedFile_RECURSES)
+#error Recursive header files inclusion detected in MappedFile.h
+#else // defined(MappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MappedFile_RECURSES
+
+#if !defined MappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define MappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MappedFile
+  /**
+   * Description of class 'MappedFile' <p>
+   * \brief Aim: Gives access to the bytes of a file through a memory
+   * mapping (mmap), either read-only or writable.
+   *
+   * Pages are loaded on demand by the system and shared with the page
+   * cache, so that opening a large file neither reads it nor copies
+   * it. A writable mapping writes back to the file: modified pages
+   * are flushed by flush() or when the file is closed.
+   *
+   * On WIN32, the file is read into a buffer instead (and written
+   * back on close when writable), so that the same interface is
+   * available.
+   *
+   * Errors are reported by throwing IOException.
+   *
+   * @see MappedImageView, VolReader::mapVol, RawReader::mapRaw8
+   */
+  class MappedFile
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Access modes of a mapping.
+    enum Mode { READ_ONLY, READ_WRITE };
+
+    typedef DGtal::uint64_t Size;
+
+    /**
+     * Constructor. The object is not associated to any file.
+     */
+    MappedFile();
+
+    /**
+     * Constructor. Maps the file @a filename.
+     * @param filename the name of an existing file.
+     * @param aMode the access mode.
+     */
+    MappedFile( const std::string & filename, const Mode aMode = READ_ONLY );
+
+    /**
+     * Destructor. Closes the mapping.
+     */
+    ~MappedFile();
+
+    /**
+     * Maps the file @a filename (the previous mapping is closed).
+     * @param filename the name of an existing file.
+     * @param aMode the access mode.
+     */
+    void open( const std::string & filename, const Mode aMode = READ_ONLY );
+
+    /**
+     * Resizes the file @a filename to @a aSize bytes, creating it if
+     * needed, and maps it in READ_WRITE mode. The first bytes of an
+     * existing file (e.g. a header) are kept and the added bytes are
+     * zeroed: truncate the file beforehand to get only zeroed bytes.
+     * @param filename the name of the file.
+     * @param aSize the size of the file in bytes.
+     */
+    void create( const std::string & filename, const Size aSize );
+
+    /**
+     * Writes back the modified pages of a writable mapping.
+     */
+    void flush();
+
+    /**
+     * Flushes and unmaps the file.
+     */
+    void close();
+
+    /**
+     * @return 'true' if a file is associated to this object.
+     */
+    bool isOpen() const;
+
+    /**
+     * @return 'true' if the file is memory-mapped (false for the
+     * WIN32 buffer fallback).
+     */
+    bool isMapped() const;
+
+    /**
+     * @return 'true' if the file has been opened in READ_WRITE mode.
+     */
+    bool isWritable() const;
+
+    /**
+     * @return the size of the file in bytes.
+     */
+    Size size() const;
+
+    /**
+     * @return a pointer on the first byte of the file.
+     */
+    const char* data() const;
+
+    /**
+     * @return a mutable pointer on the first byte of the file.
+     * @throw IOException if the file is mapped read-only.
+     */
+    char* data();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Name of the file.
+    std::string myFilename;
+    /// First byte of the file.
+    char* myData;
+    /// Size of the file in bytes.
+    Size mySize;
+    /// Access mode.
+    Mode myMode;
+    /// Tells if myData is memory-mapped.
+    bool myIsMapped;
+    /// Storage used when the file cannot be mapped (WIN32).
+    std::vector<char> myBuffer;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MappedFile ( const MappedFile & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MappedFile & operator= ( const MappedFile & other );
+
+  }; // end of class MappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MappedFile & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/MappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MappedFile_h
+
+#undef MappedFile_RECURSES
+#endif // else defined(MappedFile_RECURSES)
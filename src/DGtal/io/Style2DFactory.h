@@ -51,6 +51,7 @@
 #include "DGtal/geometry/curves/FreemanChain.h"
 #include "DGtal/geometry/curves/GeometricalDSS.h"
 #include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -0,0 +1,341 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContoursReader.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BinaryContoursReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContoursReader_RECURSES)
+#error Recursive header files inclusion detected in BinaryContoursReader.h
+#else // defined(BinaryContoursReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContoursReader_RECURSES
+
+#if !defined BinaryContoursReader_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContoursReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/io/BinaryContoursFormat.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryContoursReader
+  /**
+   * Description of template class 'BinaryContoursReader' <p>
+   * \brief Aim: Reads a file of contours written with the binary
+   * format described in BinaryContoursFormat (see
+   * BinaryContoursWriter).
+   *
+   * The file is memory-mapped (read into memory on systems without
+   * mmap) and the contours are never copied: points(i) and codes(i)
+   * return ranges whose iterators decode the points or the Freeman
+   * codes directly from the mapped file. Opening a file only checks
+   * its header and its index, whatever its size.
+   *
+   * @code
+   * BinaryContoursReader<Z2i::Point> reader( "contours.bin" );
+   * for ( unsigned int i = 0; i < reader.size(); ++i )
+   *   {
+   *     std::vector<Z2i::Point> contour;
+   *     reader.getPoints( i, contour );
+   *     ...
+   *   }
+   * @endcode
+   *
+   * @tparam TPoint the type of points, whose dimension must be the
+   * one of the file (2 for Freeman chains).
+   *
+   * @see testBinaryContoursReader.cpp
+   */
+  template <typename TPoint>
+  class BinaryContoursReader
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TPoint Point;
+    typedef typename Point::Component Integer;
+    typedef BinaryContoursFormat Format;
+    typedef std::size_t Size;
+
+    /**
+     * Iterator on the points of a contour of kind POINTS, reading
+     * the coordinates in the mapped file.
+     */
+    class ConstPointIterator
+      : public boost::iterator_facade< ConstPointIterator, Point const,
+                                       boost::random_access_traversal_tag,
+                                       Point >
+    {
+    public:
+      /// Default constructor.
+      ConstPointIterator() : myPtr( 0 ), myDimension( 0 ) {}
+      /**
+       * Constructor.
+       * @param ptr a pointer on the coordinates of a point.
+       * @param dimension the dimension of the points.
+       */
+      ConstPointIterator( const DGtal::int32_t* ptr, Dimension dimension )
+        : myPtr( ptr ), myDimension( dimension ) {}
+    private:
+      friend class boost::iterator_core_access;
+      Point dereference() const
+      {
+        Point p;
+        for ( Dimension k = 0; k < Point::dimension; ++k )
+          p[ k ] = (Integer) myPtr[ k ];
+        return p;
+      }
+      bool equal( const ConstPointIterator & other ) const
+      { return myPtr == other.myPtr; }
+      void increment() { myPtr += myDimension; }
+      void decrement() { myPtr -= myDimension; }
+      void advance( std::ptrdiff_t n ) { myPtr += n * (std::ptrdiff_t) myDimension; }
+      std::ptrdiff_t distance_to( const ConstPointIterator & other ) const
+      { return ( other.myPtr - myPtr ) / (std::ptrdiff_t) myDimension; }
+      /// The coordinates of the current point.
+      const DGtal::int32_t* myPtr;
+      /// The dimension of the points.
+      Dimension myDimension;
+    };
+
+    /**
+     * Iterator on the codes ('0' to '3') of a Freeman chain, unpacked
+     * from the mapped file.
+     */
+    class ConstCodeIterator
+      : public boost::iterator_facade< ConstCodeIterator, char const,
+                                       boost::random_access_traversal_tag,
+                                       char >
+    {
+    public:
+      /// Default constructor.
+      ConstCodeIterator() : myCodes( 0 ), myPos( 0 ) {}
+      /**
+       * Constructor.
+       * @param codes a pointer on the packed codes.
+       * @param pos the position of the code in the chain.
+       */
+      ConstCodeIterator( const unsigned char* codes, std::ptrdiff_t pos )
+        : myCodes( codes ), myPos( pos ) {}
+    private:
+      friend class boost::iterator_core_access;
+      char dereference() const
+      { return (char) ( '0' + ( ( myCodes[ myPos >> 2 ] >> ( 2 * ( myPos & 3 ) ) ) & 3 ) ); }
+      bool equal( const ConstCodeIterator & other ) const
+      { return ( myCodes == other.myCodes ) && ( myPos == other.myPos ); }
+      void increment() { ++myPos; }
+      void decrement() { --myPos; }
+      void advance( std::ptrdiff_t n ) { myPos += n; }
+      std::ptrdiff_t distance_to( const ConstCodeIterator & other ) const
+      { return other.myPos - myPos; }
+      /// The packed codes of the chain.
+      const unsigned char* myCodes;
+      /// The position of the current code.
+      std::ptrdiff_t myPos;
+    };
+
+    typedef boost::iterator_range<ConstPointIterator> PointRange;
+    typedef boost::iterator_range<ConstCodeIterator> CodeRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~BinaryContoursReader();
+
+    /**
+     * Constructor. No file is opened.
+     */
+    BinaryContoursReader();
+
+    /**
+     * Constructor. Opens the file [filename].
+     * @param filename the name of a binary contours file.
+     * @throw IOException if the file can't be read or is not valid.
+     */
+    BinaryContoursReader( const std::string & filename );
+
+    /**
+     * Maps the file [filename] and checks its header and index.
+     * @param filename the name of a binary contours file.
+     * @throw IOException if the file can't be read or is not valid.
+     */
+    void open( const std::string & filename );
+
+    /**
+     * Unmaps the current file. Ranges given before become invalid.
+     */
+    void close();
+
+    /**
+     * @return 'true' if a file is opened.
+     */
+    bool isOpen() const;
+
+    /**
+     * @return the kind of contours stored in the file.
+     */
+    Format::Kind kind() const;
+
+    /**
+     * @return the number of contours of the file.
+     */
+    Size size() const;
+
+    /**
+     * @param i the index of a contour.
+     * @return its number of points (kind POINTS) or codes (kind
+     * FREEMAN_CHAINS).
+     */
+    Size nbElements( Size i ) const;
+
+    /**
+     * @param i the index of a contour of kind POINTS.
+     * @return the range of its points, read in place.
+     */
+    PointRange points( Size i ) const;
+
+    /**
+     * @param i the index of a contour of kind FREEMAN_CHAINS.
+     * @return the range of its codes, read in place.
+     */
+    CodeRange codes( Size i ) const;
+
+    /**
+     * @param i the index of a non empty contour.
+     * @return its first point.
+     */
+    Point firstPoint( Size i ) const;
+
+    /**
+     * Copies the points of a contour of any kind. For Freeman chains,
+     * the points are the ones of FreemanChain::getContourPoints (no
+     * point for an empty chain).
+     *
+     * @param i the index of a contour.
+     * @param aContour (returns) the points of the contour.
+     */
+    void getPoints( Size i, std::vector<Point> & aContour ) const;
+
+    /**
+     * Copies a contour of kind FREEMAN_CHAINS.
+     *
+     * @param i the index of a contour.
+     * @param fc (returns) the Freeman chain.
+     */
+    template <typename TInteger>
+    void getFreemanChain( Size i, FreemanChain<TInteger> & fc ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The beginning of the file in memory.
+    const char* myData;
+    /// The size of the file.
+    Size mySize;
+    /// The header of the file.
+    const Format::Header* myHeader;
+    /// The index of the file.
+    const Format::IndexEntry* myIndex;
+    /// The content of the file when it is not memory-mapped.
+    std::vector<DGtal::uint64_t> myBuffer;
+    /// Tells if myData is memory-mapped.
+    bool myIsMapped;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BinaryContoursReader ( const BinaryContoursReader & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BinaryContoursReader & operator= ( const BinaryContoursReader & other );
+
+  }; // end of class BinaryContoursReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BinaryContoursReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BinaryContoursReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const BinaryContoursReader<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BinaryContoursReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContoursReader_h
+
+#undef BinaryContoursReader_RECURSES
+#endif // else defined(BinaryContoursReader_RECURSES)
@@ -0,0 +1,253 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickedVolumeReader.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BrickedVolumeReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickedVolumeReader_RECURSES)
+#error Recursive header files inclusion detected in BrickedVolumeReader.h
+#else // defined(BrickedVolumeReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickedVolumeReader_RECURSES
+
+#if !defined BrickedVolumeReader_h
+/** Prevents repeated inclusion of headers. */
+#define BrickedVolumeReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/MappedFile.h"
+#include "DGtal/io/BrickedVolumeFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickedVolumeReader
+  /**
+   * Description of template class 'BrickedVolumeReader' <p>
+   * \brief Aim: Reads a 3D volume written with the chunked and
+   * compressed format described in BrickedVolumeFormat (see
+   * BrickedVolumeWriter).
+   *
+   * The file is memory-mapped and opening it only checks its header
+   * and its index. Each brick can then be decoded independently, so
+   * that importSubDomain() only decompresses the bricks intersecting
+   * the requested region. Bricks are decoded in parallel with OpenMP
+   * when the image stores its values in independent rows (see
+   * details::HasContiguousRows).
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * BrickedVolumeReader<Image> reader( "volume.bvol" );
+   * Image roi = reader.importSubDomain( Z3i::Domain( Z3i::Point( 10, 10, 10 ),
+   *                                                  Z3i::Point( 50, 50, 50 ) ) );
+   * @endcode
+   *
+   * @tparam TImageContainer a model of CImage on a 3D domain, whose
+   * values can be cast from TFileValue.
+   * @tparam TFileValue the type of the values in the file.
+   *
+   * @see BrickedVolumeWriter, testBrickedVolume.cpp
+   */
+  template <typename TImageContainer,
+            typename TFileValue = typename TImageContainer::Value>
+  class BrickedVolumeReader
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename Domain::Point Point;
+    typedef TFileValue FileValue;
+    typedef BrickedVolumeFormat Format;
+    typedef std::size_t Size;
+
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+    BOOST_STATIC_ASSERT( Domain::dimension == 3 );
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Imports a whole volume.
+     * @param filename the name of a bricked volume file.
+     * @return an image on the domain [0,X-1]x[0,Y-1]x[0,Z-1].
+     * @throw IOException if the file can't be read or is not valid.
+     */
+    static ImageContainer importBrickedVolume( const std::string & filename );
+
+    /**
+     * Imports a region of a volume.
+     * @param filename the name of a bricked volume file.
+     * @param aROI a domain included in the domain of the volume.
+     * @return an image on [aROI].
+     * @throw IOException if the file can't be read or is not valid, or
+     * if [aROI] is not included in the domain of the volume.
+     */
+    static ImageContainer importBrickedVolume( const std::string & filename,
+                                               const Domain & aROI );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~BrickedVolumeReader();
+
+    /**
+     * Constructor. Maps the file [filename] and checks its header and
+     * its index.
+     * @param filename the name of a bricked volume file.
+     * @throw IOException if the file can't be read or is not valid.
+     */
+    BrickedVolumeReader( const std::string & filename );
+
+    /**
+     * @return the domain [0,X-1]x[0,Y-1]x[0,Z-1] of the volume.
+     */
+    Domain domain() const;
+
+    /**
+     * @return the log2 of the side of the bricks.
+     */
+    unsigned int logBrickSize() const;
+
+    /**
+     * @return the number of bricks.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @param i the index of a brick.
+     * @return the domain of the brick (clipped to the volume).
+     */
+    Domain brickDomain( const Size i ) const;
+
+    /**
+     * @param i the index of a brick.
+     * @return the codec of its record.
+     */
+    Format::Codec codec( const Size i ) const;
+
+    /**
+     * Decodes the values of a brick, x first then y then z.
+     * @param i the index of a brick.
+     * @param values (returns) the values of the brick.
+     * @throw IOException if the record is not valid.
+     */
+    void decodeBrick( const Size i, std::vector<FileValue> & values ) const;
+
+    /**
+     * @return the whole volume.
+     * @throw IOException if a record is not valid.
+     */
+    ImageContainer importVolume() const;
+
+    /**
+     * Decodes the bricks intersecting [aROI].
+     * @param aROI a domain included in domain().
+     * @return an image on [aROI].
+     * @throw IOException if [aROI] is not included in domain() or if a
+     * record is not valid.
+     */
+    ImageContainer importSubDomain( const Domain & aROI ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The mapped file.
+    CountedPtr<MappedFile> myFile;
+    /// A copy of the header.
+    Format::Header myHeader;
+    /// A copy of the index.
+    std::vector<Format::IndexEntry> myIndex;
+    /// The number of bricks along x, y and z.
+    DGtal::uint32_t myNbBricks[ 3 ];
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * Forbidden by default.
+     */
+    BrickedVolumeReader();
+
+  }; // end of class BrickedVolumeReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BrickedVolumeReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BrickedVolumeReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TFileValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BrickedVolumeReader<TImageContainer, TFileValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BrickedVolumeReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickedVolumeReader_h
+
+#undef BrickedVolumeReader_RECURSES
+#endif // else defined(BrickedVolumeReader_RECURSES)
@@ -46,6 +46,7 @@
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/MappedImageView.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -101,6 +102,30 @@ namespace DGtal
      * @return an instance of the ImageContainer.
      */
     static ImageContainer importLongvol(const std::string & filename) ;
+
+    /// Read-only view on the values of a memory-mapped Longvol file.
+    typedef MappedImageView<typename ImageContainer::Domain, DGtal::uint64_t> MappedImage;
+
+    /** 
+     * Maps a Longvol file in memory and returns a read-only view on
+     * its values: nothing is read until values are accessed. The
+     * values (little-endian 64 bits words) are read in place on a
+     * little-endian host, and copied when they are not 8 bytes
+     * aligned in the file (see MappedImageView::isMapped).
+     * 
+     * @param filename the file name to map.
+     * @return a view on the values of the file.
+     */
+    static MappedImage mapLongvol(const std::string & filename) ;
+
+    /** 
+     * Reads the header of a Longvol file.
+     * @param filename the file name to read.
+     * @param extent (returns) the size of the volume.
+     * @return the offset of the first voxel in the file.
+     */
+    static long getDataOffset(const std::string & filename,
+                              typename ImageContainer::Domain::Vector & extent) ;
     
    
     
@@ -177,6 +202,11 @@ namespace DGtal
     
     //! Global list of required fields in a .longvol file
     static const char *requiredHeaders[];
+
+    //! Opens a .longvol file, reads its header and returns the file
+    //! positioned on the first voxel (throws IOException on errors)
+    static FILE * openLongvol( const std::string & filename, 
+                               int & sx, int & sy, int & sz );
    
   }; // end of class LongvolReader
 
@@ -44,6 +44,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/images/MappedImageView.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -103,6 +104,19 @@ namespace DGtal
      */
     static ImageContainer importRaw8(const std::string & filename,
              const Vector & extent) ;
+
+    /// View on the values of a memory-mapped raw (8bits) file.
+    typedef MappedImageView<typename ImageContainer::Domain, unsigned char> MappedImage;
+
+    /** 
+     * Maps a Raw (8bits) file in memory and returns a read-only
+     * view on its values, without reading or copying them.
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @return a view on the values of the file.
+     */
+    static MappedImage mapRaw8(const std::string & filename,
+                               const Vector & extent) ;
     
   }; // end of class RawReader
 
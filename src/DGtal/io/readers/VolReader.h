@@ -44,6 +44,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/images/MappedImageView.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -99,6 +100,31 @@ namespace DGtal
      * @return an instance of the ImageContainer.
      */
     static ImageContainer importVol(const std::string & filename) ;
+
+    /// View on the voxels of a memory-mapped Vol file.
+    typedef MappedImageView<typename ImageContainer::Domain, unsigned char> MappedImage;
+
+    /** 
+     * Maps a Vol file in memory after parsing its header, and
+     * returns a read-only view on its voxels. Nothing is read or
+     * copied until voxels are accessed, so opening large or many
+     * volumes is cheap.
+     * 
+     * @param filename the file name to map.
+     * @return a view on the voxels of the file.
+     */
+    static MappedImage mapVol(const std::string & filename) ;
+
+    /** 
+     * Reads the header of a Vol file, so that its voxels (8 bits,
+     * x first, then y, then z) can be streamed without importing
+     * the whole volume.
+     * @param filename the file name to read.
+     * @param extent (returns) the size of the volume.
+     * @return the offset of the first voxel in the file.
+     */
+    static long getDataOffset(const std::string & filename,
+                              typename ImageContainer::Domain::Vector & extent) ;
     
    
     
@@ -157,6 +183,11 @@ namespace DGtal
     
     //! Global list of required fields in a .vol file
     static const char *requiredHeaders[];
+
+    //! Opens a .vol file, reads its header and returns the file
+    //! positioned on the first voxel (throws IOException on errors)
+    static FILE * openVol( const std::string & filename, 
+                           int & sx, int & sy, int & sz );
    
   }; // end of class VolReader
 
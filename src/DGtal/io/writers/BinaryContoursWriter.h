@@ -0,0 +1,262 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContoursWriter.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BinaryContoursWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContoursWriter_RECURSES)
+#error Recursive header files inclusion detected in BinaryContoursWriter.h
+#else // defined(BinaryContoursWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContoursWriter_RECURSES
+
+#if !defined BinaryContoursWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContoursWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/io/BinaryContoursFormat.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BinaryContoursWriter
+  /**
+   * Description of class 'BinaryContoursWriter' <p>
+   * \brief Aim: Export a sequence of contours (digital points or
+   * Freeman chains) with the binary format described in
+   * BinaryContoursFormat.
+   *
+   * Contours are streamed to the file one at a time, so that a
+   * program can export an arbitrary number of contours without
+   * keeping them in memory. Only the index (16 bytes per contour) is
+   * kept until close() writes it at the end of the file.
+   *
+   * @code
+   * BinaryContoursWriter writer;
+   * writer.open( "contours.bin", BinaryContoursFormat::FREEMAN_CHAINS );
+   * for ( ... )
+   *   writer.addFreemanChain( fc );
+   * writer.close();
+   * @endcode
+   *
+   * Coordinates are stored as 32 bits integers.
+   *
+   * @see BinaryContoursReader, testBinaryContoursReader.cpp
+   */
+  class BinaryContoursWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef BinaryContoursFormat Format;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Export all the contours of [aVectContours] as point contours.
+     *
+     * @param filename name of the output file.
+     * @param aVectContours a vector of contours, each one given as a
+     * vector of points.
+     * @return true if no errors occur.
+     */
+    template <typename TPoint>
+    static bool exportPointContours
+    ( const std::string & filename,
+      const std::vector< std::vector<TPoint> > & aVectContours );
+
+    /**
+     * Export all the Freeman chains of [aVectChains].
+     *
+     * @param filename name of the output file.
+     * @param aVectChains a vector of 4-connected Freeman chains.
+     * @return true if no errors occur.
+     */
+    template <typename TInteger>
+    static bool exportFreemanChains
+    ( const std::string & filename,
+      const std::vector< FreemanChain<TInteger> > & aVectChains );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor. Closes the file if necessary.
+     */
+    ~BinaryContoursWriter();
+
+    /**
+     * Constructor. No file is opened.
+     */
+    BinaryContoursWriter();
+
+    /**
+     * Opens the file [filename] and writes a provisional header.
+     *
+     * @param filename name of the output file.
+     * @param kind the kind of contours stored in the file.
+     * @param dimension the dimension of the points (must be 2 for
+     * Freeman chains).
+     * @return 'true' if the file was successfully opened.
+     */
+    bool open( const std::string & filename,
+               Format::Kind kind,
+               Dimension dimension = 2 );
+
+    /**
+     * @return 'true' if a file is opened.
+     */
+    bool isOpen() const;
+
+    /**
+     * Appends the contour made of the points of the range
+     * [itb,ite). The file must have been opened with kind POINTS.
+     *
+     * @tparam TConstIterator a model of forward iterator on points.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     */
+    template <typename TConstIterator>
+    void addPointContour( TConstIterator itb, TConstIterator ite );
+
+    /**
+     * Appends the 4-connected Freeman chain [fc]. The file must have
+     * been opened with kind FREEMAN_CHAINS.
+     *
+     * @param fc any Freeman chain made of the codes '0' to '3'.
+     */
+    template <typename TInteger>
+    void addFreemanChain( const FreemanChain<TInteger> & fc );
+
+    /**
+     * Writes the index, updates the header and closes the file.
+     * @return 'true' if no errors occurred while writing the file.
+     */
+    bool close();
+
+    /**
+     * @return the number of contours written so far.
+     */
+    DGtal::uint64_t nbContours() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output file.
+    std::ofstream myOut;
+    /// The kind of contours of the file.
+    Format::Kind myKind;
+    /// The dimension of the points.
+    Dimension myDimension;
+    /// The offset of the next record.
+    DGtal::uint64_t myOffset;
+    /// The index of the contours written so far.
+    std::vector<Format::IndexEntry> myIndex;
+    /// A buffer used to pack a record.
+    std::vector<char> myBuffer;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BinaryContoursWriter ( const BinaryContoursWriter & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BinaryContoursWriter & operator= ( const BinaryContoursWriter & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Writes the content of myBuffer as the record of a new contour
+     * with [nbElements] points or codes, padded to a multiple of 8
+     * bytes.
+     *
+     * @param nbElements the number of points or codes of the contour.
+     */
+    void writeRecord( DGtal::uint64_t nbElements );
+
+  }; // end of class BinaryContoursWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BinaryContoursWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BinaryContoursWriter' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const BinaryContoursWriter & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BinaryContoursWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContoursWriter_h
+
+#undef BinaryContoursWriter_RECURSES
+#endif // else defined(BinaryContoursWriter_RECURSES)
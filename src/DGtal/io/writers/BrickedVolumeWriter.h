@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickedVolumeWriter.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BrickedVolumeWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickedVolumeWriter_RECURSES)
+#error Recursive header files inclusion detected in BrickedVolumeWriter.h
+#else // defined(BrickedVolumeWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickedVolumeWriter_RECURSES
+
+#if !defined BrickedVolumeWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BrickedVolumeWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/io/BrickedVolumeFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickedVolumeWriter
+  /**
+   * Description of template class 'BrickedVolumeWriter' <p>
+   * \brief Aim: Export a 3D volume with the chunked and compressed
+   * format described in BrickedVolumeFormat.
+   *
+   * The volume is streamed to the file slice by slice (z constant,
+   * values x first then y). Only one layer of bricks (2^logBrickSize
+   * slices) is kept in memory: when it is complete, its bricks are
+   * compressed (in parallel with OpenMP) and written. The index is
+   * written at the end of the file by close().
+   *
+   * @code
+   * BrickedVolumeWriter<unsigned char> writer;
+   * writer.open( "volume.bvol", extent );
+   * for ( int z = 0; z < extent[ 2 ]; ++z )
+   *   writer.addSlice( slice.begin() );
+   * writer.close();
+   * @endcode
+   *
+   * @tparam TValue the type of the values, trivially copyable.
+   *
+   * @see BrickedVolumeReader, testBrickedVolume.cpp
+   */
+  template <typename TValue>
+  class BrickedVolumeWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TValue Value;
+    typedef BrickedVolumeFormat Format;
+    /// Size of a volume.
+    typedef PointVector<3, DGtal::int32_t> Vector;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Export a 3D image.
+     *
+     * @tparam TImage a model of CConstImage whose values can be cast to Value.
+     * @param filename name of the output file.
+     * @param aImage the image to export. Its domain lower bound is
+     * written at (0,0,0).
+     * @param logBrickSize the log2 of the side of the bricks.
+     * @return true if no errors occur.
+     */
+    template <typename TImage>
+    static bool exportBrickedVolume( const std::string & filename,
+                                     const TImage & aImage,
+                                     const unsigned int logBrickSize = 5 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. No file is opened.
+     */
+    BrickedVolumeWriter();
+
+    /**
+     * Destructor. Closes the file if necessary.
+     */
+    ~BrickedVolumeWriter();
+
+    /**
+     * Opens the file [filename] and writes a provisional header.
+     * @param filename name of the output file.
+     * @param extent the size of the volume.
+     * @param logBrickSize the log2 of the side of the bricks, at most
+     * Format::MAX_LOG_BRICK_SIZE.
+     * @return 'true' if the file was successfully opened.
+     */
+    bool open( const std::string & filename, const Vector & extent,
+               const unsigned int logBrickSize = 5 );
+
+    /**
+     * @return 'true' if a file is opened.
+     */
+    bool isOpen() const;
+
+    /**
+     * Appends the next slice of the volume.
+     * @tparam TConstIterator a model of input iterator on values
+     * convertible to Value.
+     * @param it an iterator on the extent[0]*extent[1] values of the
+     * slice, x first then y.
+     */
+    template <typename TConstIterator>
+    void addSlice( TConstIterator it );
+
+    /**
+     * @return the number of slices added so far.
+     */
+    DGtal::uint32_t nbSlices() const;
+
+    /**
+     * Writes the index, updates the header and closes the file.
+     * @return 'true' if all the slices have been added and no errors
+     * occurred while writing the file.
+     */
+    bool close();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output file.
+    std::ofstream myOut;
+    /// The header of the file.
+    Format::Header myHeader;
+    /// The offset of the next record.
+    DGtal::uint64_t myOffset;
+    /// The index of the bricks written so far.
+    std::vector<Format::IndexEntry> myIndex;
+    /// The slices of the current layer of bricks.
+    std::vector<Value> myLayer;
+    /// The number of slices in myLayer.
+    DGtal::uint32_t myLayerDepth;
+    /// The number of slices added so far.
+    DGtal::uint32_t myNbSlices;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BrickedVolumeWriter ( const BrickedVolumeWriter & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BrickedVolumeWriter & operator= ( const BrickedVolumeWriter & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Compresses and writes the bricks of the slices of myLayer.
+     */
+    void writeLayer();
+
+  }; // end of class BrickedVolumeWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BrickedVolumeWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BrickedVolumeWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const BrickedVolumeWriter<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BrickedVolumeWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickedVolumeWriter_h
+
+#undef BrickedVolumeWriter_RECURSES
+#endif // else defined(BrickedVolumeWriter_RECURSES)
@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/MappedImageView.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -85,6 +86,21 @@ namespace DGtal
      */
     static bool exportRaw8(const std::string & filename, const Image &aImage, 
 			   const Functor & aFunctor = Functor());
+
+    /// Writable view on the values of a memory-mapped raw (8bits) file.
+    typedef MappedImageView<typename Image::Domain, unsigned char> MappedImage;
+
+    /** 
+     * Creates a raw (8bits) file of zeroed values for the domain
+     * @a aDomain and maps it in memory. Values set through the
+     * returned view are written to the file by the system.
+     *
+     * @param filename name of the output file
+     * @param aDomain the domain of the image
+     * @return a writable view on the values of the file.
+     */
+    static MappedImage createMappedRaw8(const std::string & filename,
+                                        const typename Image::Domain & aDomain);
     
   };
 }//namespace
@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/MappedImageView.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -85,6 +86,32 @@ namespace DGtal
      */
     static bool exportVol(const std::string & filename, const Image &aImage, 
 			  const Functor & aFunctor = Functor()) ;
+
+    /// Writable view on the voxels of a memory-mapped Vol file.
+    typedef MappedImageView<typename Image::Domain, unsigned char> MappedImage;
+
+    /** 
+     * Creates a Vol file for the domain @a aDomain (header and
+     * zeroed voxels) and maps it in memory. Voxels set through the
+     * returned view are written to the file by the system, without
+     * building the image in memory first.
+     * 
+     * @param filename name of the output file
+     * @param aDomain the domain of the volume
+     * @return a writable view on the voxels of the file.
+     */
+    static MappedImage createMappedVol(const std::string & filename,
+                                       const typename Image::Domain & aDomain) ;
+
+  private:
+
+    /** 
+     * Writes the header of a Vol file.
+     * @param out the output stream.
+     * @param ext the extent of the volume.
+     */
+    static void writeHeader(std::ostream & out,
+                            const typename Image::Domain::Vector & ext) ;
   };
 }//namespace
 
@@ -0,0 +1,561 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitVector.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace details
+  {
+    /**
+     * Bit manipulations on the 64-bit words of DigitalSetByBitVector.
+     */
+    struct BitWords
+    {
+      /**
+       * @param w any word.
+       * @return the number of bits set in w.
+       */
+      static unsigned int count( const DGtal::uint64_t w );
+
+      /**
+       * @param w a non null word.
+       * @return the index of the lowest bit set in w.
+       */
+      static unsigned int lowest( const DGtal::uint64_t w );
+
+      /**
+       * @param w a non null word.
+       * @return the index of the highest bit set in w.
+       */
+      static unsigned int highest( const DGtal::uint64_t w );
+    };
+  } // namespace details
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+    Description of template class 'DigitalSetByBitVector' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within a HyperRectDomain, as an array of bits (one bit per point
+    of the domain).
+
+    Each row of the domain along the first axis is stored in a whole
+    number of 64-bit words, so that:
+    - find, insert and erase are in constant time;
+    - the union (operator+=), the difference (operator-=), the
+      intersection (operator*=) and the complement are computed word by
+      word, as well as the size after these operations (popcount);
+    - the dilation and the erosion by the neighbourhood of an
+      adjacency (e.g. MetricAdjacency) are computed by shifting the
+      rows along the first axis and combining them with OR/AND.
+
+    The memory is of one bit per point of the domain whatever the size
+    of the set, which is the best choice for dense sets (thresholded
+    images, objects of the topology module). The points are visited in
+    the order of the domain.
+
+    Model of CDigitalSet.
+
+    @code
+    DigitalSetByBitVector<Z3i::Domain> set( domain );
+    SetFromImage< DigitalSetByBitVector<Z3i::Domain> >::append<Image>( set, image, 0, 255 );
+    set.dilate( Z3i::Adj6() );
+    @endcode
+
+    @tparam TDomain a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( CDomain< TDomain > ));
+
+    typedef TDomain Domain;
+    typedef DigitalSetByBitVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    typedef DGtal::uint64_t Word;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /**
+     * Bidirectional iterator on the points of the set (which cannot
+     * modify the set).
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /**
+       * Default constructor (invalid iterator).
+       */
+      ConstIterator();
+
+      /**
+       * Constructor.
+       * @param aSet the set.
+       * @param aWord the index of a word (the number of words for the
+       * end iterator).
+       * @param aBit the index of a bit set in this word.
+       */
+      ConstIterator( const Self & aSet, const std::size_t aWord,
+                     const unsigned int aBit );
+
+      reference operator*() const;
+      pointer operator->() const;
+      ConstIterator & operator++();
+      ConstIterator operator++( int );
+      ConstIterator & operator--();
+      ConstIterator operator--( int );
+      bool operator==( const ConstIterator & other ) const;
+      bool operator!=( const ConstIterator & other ) const;
+
+    private:
+      /// The set.
+      const Self * mySet;
+      /// The current word.
+      std::size_t myWord;
+      /// The current bit in the word.
+      unsigned int myBit;
+      /// The current point.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitVector( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector<Domain> & operator+=( const DigitalSetByBitVector<Domain> & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector<Domain> & operator-=( const DigitalSetByBitVector<Domain> & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector<Domain> & operator*=( const DigitalSetByBitVector<Domain> & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitVector<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * Dilates this set by the neighbourhood of an adjacency: the
+     * points of the domain with a neighbor (or themselves) in the set
+     * are added.
+     *
+     * @tparam TAdjacency a model of CAdjacency on the points of the
+     * domain, whose neighborhood is invariant by translation (like
+     * MetricAdjacency).
+     * @param anAdjacency an adjacency.
+     */
+    template <typename TAdjacency>
+    void dilate( const TAdjacency & anAdjacency );
+
+    /**
+     * Erodes this set by the neighbourhood of an adjacency: the points
+     * with a neighbor out of the set (the points out of the domain
+     * are out of the set) are removed.
+     *
+     * @tparam TAdjacency a model of CAdjacency on the points of the
+     * domain, whose neighborhood is invariant by translation (like
+     * MetricAdjacency).
+     * @param anAdjacency an adjacency.
+     */
+    template <typename TAdjacency>
+    void erode( const TAdjacency & anAdjacency );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the memory used by the set, in bytes.
+     */
+    std::size_t memory() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object (no bit set after
+     * the end of the rows, number of points).
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain;
+     */
+    const Domain & myDomain;
+
+    /**
+     * The bounds of the domain.
+     */
+    Point myLowerBound, myUpperBound;
+
+    /**
+     * The number of points of a row (along the first axis).
+     */
+    std::size_t myWidth;
+
+    /**
+     * The number of words of a row.
+     */
+    std::size_t myRowWords;
+
+    /**
+     * The mask of the bits of the last word of a row which are in
+     * the domain.
+     */
+    Word myLastWordMask;
+
+    /**
+     * The index shift of a row along each axis (0 along the first
+     * axis).
+     */
+    std::vector<std::size_t> myRowStrides;
+
+    /**
+     * The bits of the rows.
+     */
+    std::vector<Word> myWords;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point.
+     * @return 'true' if p is in the domain.
+     */
+    bool isInBounds( const Point & p ) const;
+
+    /**
+     * @param p a point of the domain.
+     * @return the index of its word.
+     */
+    std::size_t wordIndex( const Point & p ) const;
+
+    /**
+     * @param aWord the index of a word.
+     * @param aBit the index of a bit.
+     * @return the point of this bit.
+     */
+    Point bitPoint( const std::size_t aWord, const unsigned int aBit ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' if the two sets have the same domain bounds.
+     */
+    bool sameBounds( const DigitalSetByBitVector & other ) const;
+
+    /**
+     * Clears the bits after the end of the rows and counts the points.
+     */
+    void updateSize();
+
+    /**
+     * Dilates or erodes this set.
+     * @param anAdjacency an adjacency.
+     * @param isDilation 'true' for a dilation, 'false' for an erosion.
+     */
+    template <typename TAdjacency>
+    void morphology( const TAdjacency & anAdjacency, const bool isDilation );
+
+    /**
+     * Shifts a row along the first axis: the bit x of the result is
+     * the bit x + aShift of the row (0 out of the row).
+     * @param aRow the words of a row.
+     * @param aShift a shift.
+     * @param aResult the words of the shifted row.
+     */
+    void shiftRow( const Word * aRow, const long aShift, Word * aResult ) const;
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
@@ -0,0 +1,566 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByRuns.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/CDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+    Description of template class 'DigitalSetByRuns' <p>
+
+    \brief Aim: A container class for storing large sets of digital
+    points within some given domain, as runs of consecutive points
+    along the first axis.
+
+    The bounding box of the domain is cut into rows parallel to the
+    first axis, indexed by the other coordinates. Each row stores the
+    sorted list of its maximal runs (first and last abscissa). The
+    memory is thus proportional to the number of runs, which is much
+    smaller than the number of points for the digitizations of
+    shapes, and to the number of rows of the domain.
+
+    - find, insert and erase are logarithmic in the number of runs of
+      the row of the point (plus the shift of the runs of the row for
+      insert and erase);
+    - the union (operator+=), the difference (operator-=) and the
+      intersection (operator*=) of two sets with the same domain are
+      linear in their number of runs;
+    - the points are visited in the order of the domain
+      (HyperRectDomain), and the runs with runBegin() and runEnd().
+
+    Model of CDigitalSet.
+
+    @code
+    typedef DigitalSetByRuns<Z3i::Domain> Set;
+    Set set( domain );
+    ...
+    for ( Set::RunConstIterator it = set.runBegin(), itEnd = set.runEnd(); it != itEnd; ++it )
+      trace.info() << it->first << " " << it->second << " " << it.length() << std::endl;
+    @endcode
+
+    @tparam TDomain a model of CDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( CDomain< TDomain > ));
+
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+
+    /// A run: first and last abscissa (included) of consecutive points.
+    typedef std::pair<Coordinate, Coordinate> Run;
+    /// The sorted runs of a row.
+    typedef std::vector<Run> Runs;
+
+    /**
+     * Bidirectional iterator on the points of the set (which cannot
+     * modify the set).
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /**
+       * Default constructor (invalid iterator).
+       */
+      ConstIterator();
+
+      /**
+       * Constructor.
+       * @param aSet the set.
+       * @param aRow the index of a row (the number of rows for the
+       * end iterator).
+       * @param aRun the index of a run in this row.
+       * @param x the abscissa of the point in this run.
+       */
+      ConstIterator( const Self & aSet, const std::size_t aRow,
+                     const std::size_t aRun, const Coordinate x );
+
+      reference operator*() const;
+      pointer operator->() const;
+      ConstIterator & operator++();
+      ConstIterator operator++( int );
+      ConstIterator & operator--();
+      ConstIterator operator--( int );
+      bool operator==( const ConstIterator & other ) const;
+      bool operator!=( const ConstIterator & other ) const;
+
+    private:
+      /// The set.
+      const Self * mySet;
+      /// The current row.
+      std::size_t myRow;
+      /// The current run in the row.
+      std::size_t myRun;
+      /// The current point.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    /**
+     * Forward iterator on the runs of the set, given as their first
+     * and last points.
+     */
+    class RunConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef std::pair<Point, Point> value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const value_type* pointer;
+      typedef const value_type& reference;
+
+      /**
+       * Constructor.
+       * @param aSet the set.
+       * @param aRow the index of a row (the number of rows for the
+       * end iterator).
+       */
+      RunConstIterator( const Self & aSet, const std::size_t aRow );
+
+      reference operator*() const;
+      pointer operator->() const;
+
+      /**
+       * @return the number of points of the current run.
+       */
+      Size length() const;
+
+      RunConstIterator & operator++();
+      RunConstIterator operator++( int );
+      bool operator==( const RunConstIterator & other ) const;
+      bool operator!=( const RunConstIterator & other ) const;
+
+    private:
+      /// The set.
+      const Self * mySet;
+      /// The current row.
+      std::size_t myRow;
+      /// The current run in the row.
+      std::size_t myRun;
+      /// The first and last points of the current run.
+      value_type myRunPoints;
+
+      /// Sets the current run points.
+      void update();
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns<Domain> & operator+=( const DigitalSetByRuns<Domain> & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns<Domain> & operator-=( const DigitalSetByRuns<Domain> & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns<Domain> & operator*=( const DigitalSetByRuns<Domain> & aSet );
+
+    /**
+     * @return an iterator on the first run of this set.
+     */
+    RunConstIterator runBegin() const;
+
+    /**
+     * @return an iterator after the last run of this set.
+     */
+    RunConstIterator runEnd() const;
+
+    /**
+     * @return the number of runs of this set.
+     */
+    Size nbRuns() const;
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByRuns<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the memory used by the set, in bytes.
+     */
+    std::size_t memory() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object (sorted, disjoint
+     * and not adjacent runs inside the domain, number of points).
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain;
+     */
+    const Domain & myDomain;
+
+    /**
+     * The bounds of the domain.
+     */
+    Point myLowerBound, myUpperBound;
+
+    /**
+     * The index shift of a row along each axis (0 along the first
+     * axis).
+     */
+    std::vector<std::size_t> myRowStrides;
+
+    /**
+     * The runs of each row.
+     */
+    std::vector<Runs> myRows;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point.
+     * @return 'true' if p is in the bounding box of the domain.
+     */
+    bool isInBounds( const Point & p ) const;
+
+    /**
+     * @param p a point of the bounding box of the domain.
+     * @return the index of its row.
+     */
+    std::size_t rowIndex( const Point & p ) const;
+
+    /**
+     * @param aRow the index of a row.
+     * @param x an abscissa.
+     * @return the point of this row with this abscissa.
+     */
+    Point rowPoint( std::size_t aRow, const Coordinate x ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' if the two sets have the same rows.
+     */
+    bool sameRows( const DigitalSetByRuns & other ) const;
+
+    /**
+     * @param x an abscissa.
+     * @param aRun a run.
+     * @return 'true' if the run starts after x.
+     */
+    static bool startsAfter( const Coordinate x, const Run & aRun );
+
+    /**
+     * @param aRuns a list of runs.
+     * @return the number of points of the runs.
+     */
+    static Size nbPoints( const Runs & aRuns );
+
+    /**
+     * Appends the abscissa x, greater than the ones of the runs, to a
+     * list of runs.
+     * @param aRuns a list of runs.
+     * @param x an abscissa.
+     */
+    static void append( Runs & aRuns, const Coordinate x );
+
+    /**
+     * Appends a run, after the ones of the list, to a list of runs.
+     * @param aRuns a list of runs.
+     * @param aRun a run.
+     */
+    static void append( Runs & aRuns, const Run & aRun );
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
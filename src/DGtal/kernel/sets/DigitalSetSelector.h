@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -0,0 +1,277 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SimplePointOracle.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SimplePointOracle.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testSimplePointOracle.cpp
+ */
+
+#if defined(SimplePointOracle_RECURSES)
+#error Recursive header files inclusion detected in SimplePointOracle.h
+#else // defined(SimplePointOracle_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SimplePointOracle_RECURSES
+
+#if !defined SimplePointOracle_h
+/** Prevents repeated inclusion of headers. */
+#define SimplePointOracle_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplePointOracle
+  /**
+   * Description of template class 'SimplePointOracle' <p>
+   * \brief Aim: Decides in constant time if a point is simple for a
+   * digital topology, from the configuration of its neighborhood.
+   *
+   * The configuration of a point is a bit mask of the points of its
+   * 3x3 (resp. 3x3x3) neighborhood which belong to the object: the
+   * points of the neighborhood are numbered in the raster order (the
+   * first coordinate first), the central point being skipped, as in
+   * the tables of generateSimplicityTables2D.cpp and
+   * generateSimplicityTables3D.cpp.
+   *
+   * The supported digital topologies are (4,8) and (8,4) in 2D, (6,26)
+   * and (26,6) in 3D, with the adjacencies of MetricAdjacency:
+   *
+   * - in 2D, the simplicity of the 256 configurations is read in
+   *   tables embedded in this module (generated by
+   *   generateSimplicityTables2D.cpp);
+   *
+   * - in 3D, where such a table has 2^26 entries, the two topological
+   *   numbers of Bertrand and Malandain (the number of
+   *   kappa-components of the object and the number of
+   *   lambda-components of its complement in the geodesic
+   *   neighborhood of the point, the 6-adjacency being restricted to
+   *   the 18-neighborhood) are computed on the configuration with
+   *   bitwise operations only. There is no allocation and the time is
+   *   bounded by the size of the neighborhood.
+   *
+   * Contrary to Object::isSimple, which builds the geodesic
+   * neighborhoods as objects, the oracle can be shared by several
+   * threads.
+   *
+   * @code
+   Z3i::DigitalSet set( domain );
+   ...
+   SimplePointOracle<Z3i::DT26_6> oracle( Z3i::dt26_6 );
+   bool simple = oracle.isSimple( set, p );
+   * @endcode
+   *
+   * @tparam TDigitalTopology a DigitalTopology whose adjacencies are
+   * MetricAdjacency, in dimension 2 or 3.
+   */
+  template <typename TDigitalTopology>
+  class SimplePointOracle
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TDigitalTopology DigitalTopology;
+    typedef typename DigitalTopology::ForegroundAdjacency ForegroundAdjacency;
+    typedef typename DigitalTopology::BackgroundAdjacency BackgroundAdjacency;
+    typedef typename ForegroundAdjacency::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+
+    /// Bit mask of the points of the neighborhood.
+    typedef DGtal::uint32_t Configuration;
+
+    BOOST_STATIC_ASSERT(( ( Space::dimension == 2 ) || ( Space::dimension == 3 ) ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aTopology the digital topology (only (4,8) and (8,4) in
+     * 2D, (6,26) and (26,6) in 3D are valid).
+     */
+    SimplePointOracle( ConstAlias<DigitalTopology> aTopology );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of points of the neighborhood (8 or 26).
+     */
+    unsigned int size() const;
+
+    /**
+     * @param i the index of a point of the neighborhood (less than size()).
+     * @return the vector from the central point to this point.
+     */
+    const Vector & offset( unsigned int i ) const;
+
+    /**
+     * @return the configuration of the kappa-neighbors of the central
+     * point.
+     */
+    Configuration kappaNeighbors() const;
+
+    /**
+     * @tparam PointPredicate a model of CPointPredicate.
+     * @param aPredicate the predicate of the points of the object.
+     * @param p any point.
+     * @return the configuration of the neighborhood of @a p.
+     */
+    template <typename PointPredicate>
+    Configuration configuration( const PointPredicate & aPredicate,
+                                 const Point & p ) const;
+
+    /**
+     * @param cfg the configuration of a point of the object.
+     * @return 'true' if this point is simple.
+     */
+    bool isSimple( const Configuration cfg ) const;
+
+    /**
+     * @tparam PointPredicate a model of CPointPredicate.
+     * @param aPredicate the predicate of the points of the object.
+     * @param p any point of the object.
+     * @return 'true' if @a p is simple.
+     */
+    template <typename PointPredicate>
+    bool isSimple( const PointPredicate & aPredicate, const Point & p ) const;
+
+    /**
+     * Computes the simplicity of a configuration from the topological
+     * numbers, without the tables. It is the method used by isSimple
+     * in 3D.
+     *
+     * @param cfg the configuration of a point of the object.
+     * @return 'true' if this point is simple.
+     */
+    bool computeSimplicity( const Configuration cfg ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the digital topology is supported, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digital topology.
+    const DigitalTopology * myTopology;
+
+    /// The vectors from the central point to the points of the neighborhood.
+    std::vector<Vector> myOffsets;
+
+    /// For each point of the neighborhood, its kappa-neighbors.
+    std::vector<Configuration> myKappaAdjacency;
+
+    /// For each point of the neighborhood, its lambda-neighbors.
+    std::vector<Configuration> myLambdaAdjacency;
+
+    /// The kappa-neighbors of the central point.
+    Configuration myKappaNeighbors;
+
+    /// The lambda-neighbors of the central point.
+    Configuration myLambdaNeighbors;
+
+    /// The geodesic neighborhood of the object (the 18-neighborhood
+    /// for the 6-adjacency in 3D, the whole neighborhood otherwise).
+    Configuration myKappaDomain;
+
+    /// The geodesic neighborhood of the complement.
+    Configuration myLambdaDomain;
+
+    /// The embedded table of the topology (2D), 0 otherwise.
+    const bool * myTable;
+
+    /// 'true' if the digital topology is supported.
+    bool myValidity;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    SimplePointOracle();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param cfg a set of points of the neighborhood.
+     * @param adjacency the adjacency of the points of the neighborhood.
+     * @param seeds the points the components must contain.
+     * @return the number of components of @a cfg which contain a point
+     * of @a seeds.
+     */
+    static unsigned int nbComponents( Configuration cfg,
+                                      const std::vector<Configuration> & adjacency,
+                                      const Configuration seeds );
+
+  }; // end of class SimplePointOracle
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SimplePointOracle'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SimplePointOracle' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalTopology>
+  std::ostream&
+  operator<< ( std::ostream & out, const SimplePointOracle<TDigitalTopology> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SimplePointOracle.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SimplePointOracle_h
+
+#undef SimplePointOracle_RECURSES
+#endif // else defined(SimplePointOracle_RECURSES)
@@ -0,0 +1,327 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ConnectedComponentLabelling.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testConnectedComponentLabelling.cpp
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/images/CImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Labels the connected components of a digital set or
+   * of the foreground of an image (given by a point predicate), for a
+   * translation invariant adjacency (e.g. the adjacencies 4/8 or
+   * 6/18/26 of MetricAdjacency, or the foreground adjacency @a kappa
+   * of a DigitalTopology).
+   *
+   * The labelling is a two-pass raster scan of the domain: the first
+   * pass links each foreground point to its foreground neighbors
+   * already scanned with an array-based union-find (one index per
+   * point of the domain, path halving), the second pass gives to
+   * each point the label of its root. Labels are numbered from 1 in
+   * the raster order of the first point of each component (0 is the
+   * background) and the size and the bounding box of each component
+   * are computed during the second pass. Contrary to
+   * Object::writeComponents, no set is built.
+   *
+   * The domain may also be split into tiles (slabs along the last
+   * axis) labelled independently, in parallel if DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag set to "true"), the trees
+   * of the tiles being merged along the tile borders afterwards. The
+   * labels are the same as with a single tile.
+   *
+   * @code
+   typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> LabelImage;
+   typedef ConnectedComponentLabelling<Z2i::Adj8, LabelImage> Labelling;
+   Z2i::Adj8 adj8;
+   Labelling labelling( adj8 );
+   LabelImage labels( image.domain() );
+   SimpleThresholdForegroundPredicate<Image> predicate( image, 128 );
+   unsigned int nb = labelling.compute( predicate, labels );
+   trace.info() << nb << " components, the first one has "
+                << labelling.statistics()[ 0 ].size << " points" << std::endl;
+   * @endcode
+   *
+   * @tparam TAdjacency a translation invariant adjacency (model of
+   * CAdjacency with a writeNeighbors method).
+   * @tparam TLabelImage the type of the image of labels (model of
+   * CImage on a HyperRectDomain, with an integral value type), e.g.
+   * ImageContainerBySTLVector<Domain, unsigned int>.
+   */
+  template <typename TAdjacency, typename TLabelImage>
+  class ConnectedComponentLabelling
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CImage<TLabelImage> ));
+
+    typedef TAdjacency Adjacency;
+    typedef TLabelImage LabelImage;
+    typedef typename LabelImage::Domain Domain;
+    typedef typename LabelImage::Value Label;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef std::size_t Size;
+
+    /**
+     * Statistics of a component.
+     */
+    struct ComponentStatistics
+    {
+      /// Number of points of the component
+      Size size;
+      /// Lower bound of the bounding box of the component
+      Point lowerBound;
+      /// Upper bound of the bounding box of the component
+      Point upperBound;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param anAdjacency the adjacency of the foreground points.
+     */
+    ConnectedComponentLabelling( ConstAlias<Adjacency> anAdjacency );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Labels the connected components of the points of the domain of
+     * @a labels which satisfy a predicate.
+     *
+     * @tparam PointPredicate a model of CPointPredicate.
+     * @param aPredicate the predicate of the foreground points.
+     * @param labels (returns) the image of labels (0 for the
+     * background).
+     * @param nbTiles the number of tiles (0 for the number of OpenMP
+     * threads, 1 without OpenMP).
+     *
+     * @return the number of components.
+     */
+    template <typename PointPredicate>
+    Label compute( const PointPredicate & aPredicate, LabelImage & labels,
+                   const Size nbTiles = 0 );
+
+    /**
+     * Labels the connected components of a digital set. The points of
+     * the set must belong to the domain of @a labels.
+     *
+     * @tparam DigitalSet a model of CDigitalSet.
+     * @param aSet the set of foreground points.
+     * @param labels (returns) the image of labels (0 for the
+     * background).
+     * @param nbTiles the number of tiles (0 for the number of OpenMP
+     * threads, 1 without OpenMP).
+     *
+     * @return the number of components.
+     */
+    template <typename DigitalSet>
+    Label computeFromSet( const DigitalSet & aSet, LabelImage & labels,
+                          const Size nbTiles = 0 );
+
+    /**
+     * @return the number of components of the last computation.
+     */
+    Label nbComponents() const;
+
+    /**
+     * @return the statistics of the components of the last
+     * computation (the statistics of the label @a l are at index @a
+     * l-1).
+     */
+    const std::vector<ComponentStatistics> & statistics() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The adjacency of the foreground points.
+    const Adjacency * myAdjacency;
+
+    /// The neighbors of the origin which precede it in the raster order.
+    std::vector<Vector> myOffsets;
+
+    /// Union-find forest: index of the parent of each point of the
+    /// domain (itself for a root, myBackground for the background).
+    std::vector<Size> myParent;
+
+    /// Statistics of the components.
+    std::vector<ComponentStatistics> myStatistics;
+
+    /// Value of the background in the forest.
+    static const Size myBackground = static_cast<Size>( -1 );
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    ConnectedComponentLabelling();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling ( const ConnectedComponentLabelling & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling & operator= ( const ConnectedComponentLabelling & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param nbTiles a number of tiles (0 for the number of OpenMP
+     * threads).
+     * @param domain the domain.
+     * @return the first index of each tile, and the domain size at
+     * the end.
+     */
+    std::vector<Size> tileBounds( Size nbTiles, const Domain & domain ) const;
+
+    /**
+     * Unions each foreground point of a tile with its foreground
+     * neighbors of the tile already scanned.
+     *
+     * @param domain the domain.
+     * @param begin index of the first point of the tile.
+     * @param end index after the last point of the tile.
+     * @param borderOnly if 'true', only the neighbors which are not
+     * in the tile are considered, for the points of the first slice
+     * of the tile.
+     */
+    void unionTile( const Domain & domain, const Size begin, const Size end,
+                    const bool borderOnly );
+
+    /**
+     * Second pass: labels and statistics.
+     *
+     * @param labels (returns) the image of labels.
+     * @return the number of components.
+     */
+    Label relabel( LabelImage & labels );
+
+    /**
+     * Union-find: returns the root of [i] with path halving.
+     * @param i any index of a foreground point.
+     * @return the root of [i].
+     */
+    Size findRoot( Size i );
+
+    /**
+     * Union-find: merges the trees of [i] and [j], the smallest root
+     * becoming the root of the other one.
+     * @param i any index of a foreground point.
+     * @param j any index of a foreground point.
+     */
+    void merge( Size i, Size j );
+
+    /**
+     * @param domain the domain.
+     * @param i any index of a point of the domain.
+     * @return the point of index [i] (raster order).
+     */
+    static Point pointOf( const Domain & domain, Size i );
+
+  }; // end of class ConnectedComponentLabelling
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TAdjacency, typename TLabelImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConnectedComponentLabelling<TAdjacency, TLabelImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
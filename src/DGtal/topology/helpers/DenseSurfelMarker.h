@@ -0,0 +1,240 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseSurfelMarker.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DenseSurfelMarker.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseSurfelMarker_RECURSES)
+#error Recursive header files inclusion detected in DenseSurfelMarker.h
+#else // defined(DenseSurfelMarker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseSurfelMarker_RECURSES
+
+#if !defined DenseSurfelMarker_h
+/** Prevents repeated inclusion of headers. */
+#define DenseSurfelMarker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseSurfelMarker
+  /**
+     Description of template class 'DenseSurfelMarker' <p> \brief
+     Aim: Marks surfels of a bounded cellular grid space in a dense
+     bitmap indexed by their Khalimsky coordinates.
+
+     Each surfel of the space is associated to exactly one bit: the
+     bitmap stores one slab of bits per orthogonal direction, each
+     slab being indexed by the digital coordinates of the surfel
+     (i.e. its Khalimsky coordinates divided by two). Marking,
+     unmarking and membership tests are thus constant time and never
+     allocate, contrary to a std::set<SCell>. It is used by
+     Surfaces::trackBoundary and Surfaces::trackClosedBoundary to
+     record visited bels.
+
+     The sign of the surfel is ignored: when tracking the boundary of
+     a shape given by a point predicate, a given unsigned surfel
+     appears with only one orientation.
+
+     The memory footprint is dimension x prod_i ( size( i ) + 1 )
+     bits, i.e. about 48 MB for a 512^3 space.
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+   */
+  template <typename TKSpace>
+  class DenseSurfelMarker
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef DGtal::uint64_t Word;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DenseSurfelMarker();
+
+    /**
+     * Constructor. The object is not valid until init is called.
+     */
+    DenseSurfelMarker();
+
+    /**
+     * Constructor from space. All surfels are unmarked.
+     * @param K any bounded cellular grid space.
+     */
+    DenseSurfelMarker( const KSpace & K );
+
+    /**
+     * (Re-)initializes the marker for the space [K]. All surfels are
+     * unmarked. The storage is reused whenever possible.
+     *
+     * @param K any bounded cellular grid space.
+     */
+    void init( const KSpace & K );
+
+    /**
+     * Marks the surfel [s].
+     * @param s any surfel within the bounds of the space.
+     * @return 'true' if [s] was not marked before, 'false' otherwise.
+     */
+    bool mark( const SCell & s );
+
+    /**
+     * Marks the surfel [s] with an atomic read-modify-write of its
+     * word when compiled WITH_OPENMP. Threads may thus concurrently
+     * mark surfels sharing a bitmap word.
+     *
+     * @param s any surfel within the bounds of the space.
+     * @return 'true' if [s] was not marked before, 'false' otherwise.
+     */
+    bool markConcurrent( const SCell & s );
+
+    /**
+     * Same as isMarked, but reads the word atomically when compiled
+     * WITH_OPENMP, so that it may be called while other threads call
+     * markConcurrent.
+     *
+     * @param s any surfel within the bounds of the space.
+     * @return 'true' if [s] is marked.
+     */
+    bool isMarkedConcurrent( const SCell & s ) const;
+
+    /**
+     * Unmarks the surfel [s].
+     * @param s any surfel within the bounds of the space.
+     */
+    void unmark( const SCell & s );
+
+    /**
+     * Unmarks every surfel of the range [itb,ite). This is much
+     * faster than clear() when only few surfels were marked.
+     *
+     * @tparam SCellConstIterator any input iterator on SCell.
+     * @param itb an iterator on the first surfel.
+     * @param ite an iterator after the last surfel.
+     */
+    template <typename SCellConstIterator>
+    void unmark( SCellConstIterator itb, SCellConstIterator ite );
+
+    /**
+     * @param s any surfel within the bounds of the space.
+     * @return 'true' if [s] is marked.
+     */
+    bool isMarked( const SCell & s ) const;
+
+    /**
+     * Unmarks all surfels.
+     */
+    void clear();
+
+    /**
+     * @return the number of words used by the bitmap.
+     */
+    Size nbWords() const;
+
+    /**
+     * @return the number of surfels of the space, i.e. one more than
+     * the greatest value returned by index.
+     */
+    Size size() const;
+
+    /**
+     * @param s any surfel within the bounds of the space.
+     * @return the index of the bit associated to [s].
+     */
+    Size index( const SCell & s ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The lower bound of the digital coordinates of the surfels.
+    Point myLower;
+    /// The number of digital coordinates along each axis.
+    Size myExtent[ KSpace::dimension ];
+    /// The number of bits of the slab associated to one orthogonal direction.
+    Size mySlabSize;
+    /// The bitmap.
+    std::vector<Word> myBits;
+
+  }; // end of class DenseSurfelMarker
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseSurfelMarker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseSurfelMarker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseSurfelMarker<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/DenseSurfelMarker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseSurfelMarker_h
+
+#undef DenseSurfelMarker_RECURSES
+#endif // else defined(DenseSurfelMarker_RECURSES)
@@ -0,0 +1,227 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module HomotopicThinning.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testSimplePointOracle.cpp
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/topology/SimplePointOracle.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HomotopicThinning
+  /**
+   * Description of template class 'HomotopicThinning' <p>
+   * \brief Aim: Homotopic thinning (or skeletonization when the end
+   * points are kept) of a digital set by removal of its simple
+   * points, decided by a SimplePointOracle.
+   *
+   * The thinning is a sequence of passes, each pass being made of
+   * directional subiterations: the subiteration of the direction @a
+   * d only considers the points whose neighbor in the direction @a d
+   * is in the background (2n directions), a last subiteration
+   * considering all the points. In each subiteration, the points are
+   * processed by subfields: two points whose coordinates have the
+   * same parities are not adjacent, so that the simplicity of a point
+   * does not depend on the removal of the other points of its
+   * subfield. The points of a subfield are thus tested and removed
+   * independently, in parallel if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true"), and the result is the
+   * one of a sequential removal. The thinning stops when a pass
+   * removes no point.
+   *
+   * The set is copied in a dense image of its bounding box, and the
+   * configurations of the points are read in this image.
+   *
+   * @code
+   HomotopicThinning<Z3i::DT26_6> thinning( Z3i::dt26_6 );
+   thinning.thin( vessels, true ); //curve skeleton
+   * @endcode
+   *
+   * @tparam TDigitalTopology a digital topology supported by
+   * SimplePointOracle.
+   */
+  template <typename TDigitalTopology>
+  class HomotopicThinning
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TDigitalTopology DigitalTopology;
+    typedef SimplePointOracle<DigitalTopology> Oracle;
+    typedef typename Oracle::Point Point;
+    typedef typename Oracle::Vector Vector;
+    typedef typename Oracle::Configuration Configuration;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aTopology the digital topology.
+     */
+    HomotopicThinning( ConstAlias<DigitalTopology> aTopology );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Removes the simple points of a set until none is left (except
+     * the end points if @a keepEndPoints is 'true').
+     *
+     * @tparam DigitalSet a model of CDigitalSet.
+     * @param aSet (modified) the set to thin.
+     * @param keepEndPoints if 'true', the points with only one
+     * kappa-neighbor are kept (curve skeleton).
+     * @return the number of removed points.
+     */
+    template <typename DigitalSet>
+    Size thin( DigitalSet & aSet, const bool keepEndPoints = false );
+
+    /**
+     * Removes the simple points of a set until none is left, except
+     * the anchors (and the end points if @a keepEndPoints is 'true').
+     *
+     * @tparam DigitalSet a model of CDigitalSet.
+     * @tparam PointPredicate a model of CPointPredicate.
+     * @param aSet (modified) the set to thin.
+     * @param anchors the predicate of the points which are never removed.
+     * @param keepEndPoints if 'true', the points with only one
+     * kappa-neighbor are kept (curve skeleton).
+     * @return the number of removed points.
+     */
+    template <typename DigitalSet, typename PointPredicate>
+    Size thin( DigitalSet & aSet, const PointPredicate & anchors,
+               const bool keepEndPoints = false );
+
+    /**
+     * @return the number of passes of the last thinning.
+     */
+    unsigned int nbPasses() const;
+
+    /**
+     * @return the simple point oracle.
+     */
+    const Oracle & oracle() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The simple point oracle.
+    Oracle myOracle;
+
+    /// The number of passes of the last thinning.
+    unsigned int myNbPasses;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    HomotopicThinning();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    HomotopicThinning ( const HomotopicThinning & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    HomotopicThinning & operator= ( const HomotopicThinning & other );
+
+  }; // end of class HomotopicThinning
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HomotopicThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HomotopicThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalTopology>
+  std::ostream&
+  operator<< ( std::ostream & out, const HomotopicThinning<TDigitalTopology> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
@@ -0,0 +1,346 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NestedLevelSetsContours.h
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module NestedLevelSetsContours.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NestedLevelSetsContours_RECURSES)
+#error Recursive header files inclusion detected in NestedLevelSetsContours.h
+#else // defined(NestedLevelSetsContours_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NestedLevelSetsContours_RECURSES
+
+#if !defined NestedLevelSetsContours_h
+/** Prevents repeated inclusion of headers. */
+#define NestedLevelSetsContours_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <set>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/helpers/DenseSurfelMarker.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NestedLevelSetsContours
+  /**
+     Description of template class 'NestedLevelSetsContours' <p> \brief
+     Aim: Extracts the 4-connected contours of a whole sequence of
+     nested 2D shapes S_0 \subset S_1 \subset ... \subset S_{n-1},
+     updating the contours incrementally from one shape to the next
+     one.
+
+     The shapes are given by a level image: a point p belongs to S_i
+     whenever levels( p ) <= i. Such an image is for instance obtained
+     with computeIntervalLevels from a grey-level image and a sequence
+     of intervals [min, max_i] with increasing upper bounds, as in
+     the option -thresholdRange of pgm2freeman.
+
+     Going from S_{i-1} to S_i, only the contours passing through a
+     corner of a point of level i are tracked again; the other ones
+     are kept as is. The cost of the whole sequence is thus
+     proportional to the size of the image plus the total length of
+     the contours which have changed, instead of n times the size of
+     the image for n calls to Surfaces::extractAllPointContours4C.
+
+     After each call to nextLevel, getSCellContours (resp.
+     getPointContours) returns exactly the same contours, in the same
+     order, as Surfaces::extractAll2DSCellContours (resp.
+     Surfaces::extractAllPointContours4C) called with the predicate of
+     the current shape: contours are ordered by their smallest bel and
+     closed contours end with their smallest bel.
+
+     @code
+     typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> LevelImage;
+     LevelImage levels( image.domain() );
+     NestedLevelSetsContours<Z2i::KSpace, LevelImage>::computeIntervalLevels
+       ( levels, image, minThreshold, maxThresholds );
+     NestedLevelSetsContours<Z2i::KSpace, LevelImage> nlsc;
+     nlsc.init( ks, sAdj, levels, maxThresholds.size() );
+     while ( nlsc.nextLevel() )
+       {
+         std::vector< std::vector< Z2i::Point > > contours;
+         nlsc.getPointContours( contours );
+         ...
+       }
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space, a bounded
+     KhalimskySpaceND of dimension 2.
+
+     @tparam TLevelImage the type of the level image, a model of
+     CImage whose values are unsigned integers (e.g.
+     ImageContainerBySTLVector<Z2i::Domain, unsigned int>), defined
+     on the domain of the space.
+   */
+  template <typename TKSpace, typename TLevelImage>
+  class NestedLevelSetsContours
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef TLevelImage LevelImage;
+    typedef typename LevelImage::Value Level;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef std::size_t Size;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+       Fills the level image associated to the sequence of intervals
+       [minValue, maxValues[ i ]]: the level of a point p is the
+       smallest i such that minValue <= image( p ) <= maxValues[ i ],
+       or maxValues.size() when there is no such interval.
+
+       @tparam TImage any model of CImage.
+
+       @param levels (modified) the level image, defined on a domain
+       included in the domain of [image].
+
+       @param image any image.
+
+       @param minValue the lower bound of all intervals.
+
+       @param maxValues the upper bounds of the intervals, in
+       increasing order.
+    */
+    template <typename TImage>
+    static
+    void computeIntervalLevels( LevelImage & levels,
+                                const TImage & image,
+                                const typename TImage::Value & minValue,
+                                const std::vector<typename TImage::Value> & maxValues );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~NestedLevelSetsContours();
+
+    /**
+     * Constructor. The object is not valid until init is called.
+     */
+    NestedLevelSetsContours();
+
+    /**
+       Initializes the extraction. No level is processed yet, so that
+       the first call to nextLevel computes the contours of S_0. The
+       space, the adjacency and the level image are referenced and
+       must thus exist as long as this object is used.
+
+       @param aKSpace any bounded space of dimension 2.
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+
+       @param levels the level image, defined on the domain of [aKSpace].
+
+       @param nbLevels the number n of nested shapes. Points with a
+       level greater or equal to n belong to none of them.
+    */
+    void init( const KSpace & aKSpace,
+               const SurfelAdjacency<2> & aSurfelAdj,
+               const LevelImage & levels,
+               Level nbLevels );
+
+    /**
+       Updates the contours from the shape S_{i-1} to the next shape
+       S_i (from the empty shape to S_0 at the first call).
+
+       @return 'false' if all the levels have already been processed,
+       'true' otherwise.
+    */
+    bool nextLevel();
+
+    /**
+     * @return the number of nested shapes.
+     */
+    Level nbLevels() const;
+
+    /**
+     * @return the level i of the current shape S_i, or -1 if nextLevel
+     * was never called.
+     */
+    int level() const;
+
+    /**
+     * @return the number of contours of the current shape.
+     */
+    Size nbContours() const;
+
+    /**
+       Outputs the contours of the current shape, as
+       Surfaces::extractAll2DSCellContours does.
+
+       @param aVectSCellContour2D (modified) the vector of contours,
+       each contour being the sequence of its signed linels.
+    */
+    void getSCellContours
+    ( std::vector< std::vector<SCell> > & aVectSCellContour2D ) const;
+
+    /**
+       Outputs the contours of the current shape, as
+       Surfaces::extractAllPointContours4C does.
+
+       @param aVectPointContour2D (modified) the vector of contours,
+       each contour being the sequence of its pointels.
+    */
+    void getPointContours
+    ( std::vector< std::vector<Point> > & aVectPointContour2D ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The (aliased) space.
+    const KSpace* mySpace;
+    /// The (aliased) surfel adjacency.
+    const SurfelAdjacency<2>* mySurfelAdj;
+    /// The (aliased) level image.
+    const LevelImage* myLevels;
+    /// The number of nested shapes.
+    Level myNbLevels;
+    /// The current level, -1 before the first call to nextLevel.
+    int myLevel;
+    /// The points of the image sorted by increasing level.
+    std::vector<Point> myPoints;
+    /// The index in myPoints of the first point of each level.
+    std::vector<Size> myLevelOffsets;
+    /// Gives the index of each linel in myLabels.
+    DenseSurfelMarker<KSpace> myIndexer;
+    /// The index of the last contour that went through each linel.
+    std::vector<Size> myLabels;
+    /// All the contours tracked so far, dead ones being emptied.
+    std::vector< std::vector<SCell> > myContours;
+    /// The smallest linel of each contour.
+    std::vector<SCell> myMinSCells;
+    /// Tells if a contour belongs to the current shape.
+    std::vector<bool> myAlive;
+    /// The contours of the current shape, sorted by smallest linel.
+    std::set< std::pair<SCell, Size> > myOrder;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    NestedLevelSetsContours ( const NestedLevelSetsContours & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    NestedLevelSetsContours & operator= ( const NestedLevelSetsContours & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Outputs the Khalimsky coordinates of the linels of the space
+       having the pointel of Khalimsky coordinates [kq] in their
+       boundary.
+
+       @param linels (modified) the linels are appended to this vector.
+       @param kq the Khalimsky coordinates of a pointel of the space.
+    */
+    void addIncidentLinels( std::vector<Point> & linels, const Point & kq ) const;
+
+    /**
+       Tracks the contour of the current shape going through the
+       linel [kl] if [kl] is a bel not already part of a live contour,
+       and records it as a new live contour.
+
+       @tparam PointPredicate the type of the predicate of the current
+       shape.
+
+       @param pp the predicate of the current shape.
+       @param kl the Khalimsky coordinates of any linel of the space.
+    */
+    template <typename PointPredicate>
+    void trackFrom( const PointPredicate & pp, const Point & kl );
+
+  }; // end of class NestedLevelSetsContours
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NestedLevelSetsContours'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NestedLevelSetsContours' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TLevelImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const NestedLevelSetsContours<TKSpace, TLevelImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/NestedLevelSetsContours.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NestedLevelSetsContours_h
+
+#undef NestedLevelSetsContours_RECURSES
+#endif // else defined(NestedLevelSetsContours_RECURSES)
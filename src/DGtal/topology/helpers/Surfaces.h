@@ -45,6 +45,7 @@
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/helpers/DenseSurfelMarker.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -224,6 +225,85 @@ namespace DGtal
             const PointPredicate & pp,
             const SCell & start_surfel );
 
+    /**
+       Variant of trackBoundary which records visited bels in a dense
+       bitmap instead of a set of SCell. The boundary component is
+       returned as a contiguous vector, which is also used as the
+       frontier of the breadth-first traversal. Hence, once [surface]
+       and [marker] have reached their final size, tracking allocates
+       nothing.
+
+       The marker is not reset by this function: bels already marked
+       are considered as visited and are not tracked again. If
+       [start_surfel] is already marked, [surface] is left empty. Use
+       DenseSurfelMarker::unmark( surface.begin(), surface.end() ) to
+       reset it cheaply between independent calls.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param surface (modified) the surfels of the boundary component
+       of the shape which touches [start_surfel], in breadth-first order.
+
+       @param marker (modified) the bitmap marking visited surfels,
+       initialized with space [K].
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape,
+       which should be at least partially included in the bounds of
+       space [K].
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+    */
+    template <typename PointPredicate >
+    static 
+    void trackBoundary( std::vector<SCell> & surface,
+                        DenseSurfelMarker<KSpace> & marker,
+                        const KSpace & K,
+                        const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                        const PointPredicate & pp,
+                        const SCell & start_surfel );
+
+    /**
+       Variant of trackClosedBoundary which records visited bels in a
+       dense bitmap instead of a set of SCell. See the dense variant
+       of trackBoundary for the meaning of [surface] and [marker].
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param surface (modified) the surfels of the boundary component
+       of the shape which touches [start_surfel], in breadth-first order.
+
+       @param marker (modified) the bitmap marking visited surfels,
+       initialized with space [K].
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape,
+       which should be at least partially included in the bounds of
+       space [K].
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+    */
+    template <typename PointPredicate >
+    static 
+    void trackClosedBoundary( std::vector<SCell> & surface,
+                              DenseSurfelMarker<KSpace> & marker,
+                              const KSpace & K,
+                              const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                              const PointPredicate & pp,
+                              const SCell & start_surfel );
+
 
     /**
        Function that extracts a n-1 digital surface (specified by a
@@ -522,7 +602,8 @@ namespace DGtal
        Extract all 4-connected contours as a vector containing the sequence
        of contour Points.  Each contour is represented by a vector of
        points defined by the sequence of pointels extracted from the
-       boundary surfels. Calls extractAll2DSCellContours.
+       boundary surfels. Calls extractAll2DSCellContours (see
+       extractAllPointContours4CParallel for a parallel version).
        
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -548,6 +629,59 @@ namespace DGtal
       const PointPredicate & pp,
       const SurfelAdjacency<2> &aSAdj );
 
+    /**
+       Parallel version of extractAllPointContours4C, which gives
+       exactly the same contours in the same order. Calls
+       extractAll2DSCellContoursParallel.
+       
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param aVectPointContour2D (modified) a vector of contour represented
+       by a vector of cells (which are all surfels), containing the
+       ordered list of the boundary component of [pp].
+       
+       @param aKSpace any bounded space of dimension 2.
+
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a
+       shape. It must be callable concurrently.
+
+       @param aSAdj the surfel adjacency chosen for the tracking.
+
+       @param nbSlabs the number of slabs, 0 means one slab per
+       available thread (default).
+    */
+    template <typename PointPredicate>
+    static 
+    void extractAllPointContours4CParallel
+    ( std::vector< std::vector< Point > > & aVectPointContour2D,
+      const KSpace & aKSpace,
+      const PointPredicate & pp,
+      const SurfelAdjacency<2> &aSAdj,
+      unsigned int nbSlabs = 0 );
+
+    /**
+       Converts a 2D contour given as a sequence of signed linels into
+       the sequence of its pointels, as done by
+       extractAllPointContours4C: each linel contributes its first
+       pointel (according to its direct orientation) and the last
+       linel contributes also its second pointel.
+
+       @param aContour (returns) the sequence of points of the contour
+       (cleared before).
+
+       @param aKSpace any space of dimension 2.
+
+       @param aSCellContour2D a sequence of signed linels, for
+       instance as given by track2DBoundary.
+    */
+    static
+    void sCellContourToPoints2D( std::vector< Point > & aContour,
+                                 const KSpace & aKSpace,
+                                 const std::vector< SCell > & aSCellContour2D );
+
     
 
     /**
@@ -579,6 +713,47 @@ namespace DGtal
       const KSpace & aKSpace,
       const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
       const PointPredicate & pp );
+
+    /**
+       Parallel version of extractAll2DSCellContours, which gives
+       exactly the same contours in the same order.
+
+       The space is split into [nbSlabs] horizontal slabs (along the
+       last axis). Each slab is processed by its own thread (when
+       compiled WITH_OPENMP): its bels are found by a raster scan,
+       and contour pieces are tracked up to the slab border, bels
+       being claimed in a shared DenseSurfelMarker. Pieces are then
+       chained into full contours, each closed contour is rotated to
+       end with its smallest bel, as extractAll2DSCellContours does,
+       and contours are sorted by smallest bel.
+       
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param aVectSCellContour2D (modified) a vector of contour represented
+       by a vector of cells (which are all surfels), containing the
+       ordered list of the boundary component of [spelset].
+       
+       @param aKSpace any bounded space of dimension 2.
+       
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a
+       shape. It must be callable concurrently.
+
+       @param nbSlabs the number of slabs, 0 means one slab per
+       available thread (default).
+    */
+    template <typename PointPredicate>
+    static 
+    void extractAll2DSCellContoursParallel
+    ( std::vector< std::vector<SCell> > & aVectSCellContour2D,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      unsigned int nbSlabs = 0 );
     
 
     /**
@@ -586,7 +761,13 @@ namespace DGtal
        components of the given DigitalSet. The connected surfel set
        are given as result in a vector containing all components. The
        orientation of the resulting SCell indicates the exterior
-       orientation according the positive axis.
+       orientation according the positive axis. The surfels of each
+       component are given in breadth-first order from the first bel
+       met by the raster scan of the space.
+
+       This is a convenience wrapper around the flat version of
+       extractAllConnectedSCell, which should be preferred for big
+       volumes.
        
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -617,6 +798,101 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Extract all surfel elements associated to each connected
+       component of the boundary of the shape [pp], in a single sweep
+       of the space. The bounding box of [aKSpace] is scanned along
+       each axis; whenever a bel not already visited is met, its whole
+       boundary component is tracked with a DenseSurfelMarker and
+       appended to [aSCells]. Time and memory are thus linear in the
+       size of the space plus the number of bels, and no set of SCell
+       is ever built.
+
+       The result is flat: the bels of the i-th component are
+       aSCells[ aOffsets[ i ] ] ... aSCells[ aOffsets[ i+1 ] - 1 ], in
+       breadth-first order. Hence aOffsets.size() is the number of
+       components plus one.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aSCells (modified) the bels of all components, stored
+       consecutively.
+
+       @param aOffsets (modified) the index in [aSCells] of the first
+       bel of each component, followed by aSCells.size().
+
+       @param aKSpace any bounded space.
+       
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+       
+       @param forceOrientCellExterior if 'true', used to change the
+       default cell orientation in order to get the direction of shape
+       exterior (default =false).
+    */
+    template <typename PointPredicate >
+    static 
+    void extractAllConnectedSCell
+    ( std::vector<SCell> & aSCells,
+      std::vector<std::size_t> & aOffsets,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior=false );
+
+    /**
+       Parallel version of the flat extractAllConnectedSCell. It gives
+       the same components, possibly in a different order, and the
+       bels of a component are grouped by slab instead of being in
+       breadth-first order.
+
+       The space is split into [nbSlabs] slabs along the last axis.
+       Each slab is processed by its own thread (when compiled
+       WITH_OPENMP): its bels are found by a raster scan and tracked
+       without leaving the slab, bels being claimed in a shared
+       DenseSurfelMarker so that no bel is tracked twice. Pieces of
+       components which touch across slab borders are finally merged
+       with a union-find.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aSCells (modified) the bels of all components, stored
+       consecutively.
+
+       @param aOffsets (modified) the index in [aSCells] of the first
+       bel of each component, followed by aSCells.size().
+
+       @param aKSpace any bounded space.
+       
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a
+       shape. It must be callable concurrently.
+       
+       @param forceOrientCellExterior if 'true', used to change the
+       default cell orientation in order to get the direction of shape
+       exterior (default =false).
+
+       @param nbSlabs the number of slabs, 0 means one slab per
+       available thread (default).
+    */
+    template <typename PointPredicate >
+    static 
+    void extractAllConnectedSCellParallel
+    ( std::vector<SCell> & aSCells,
+      std::vector<std::size_t> & aOffsets,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior=false,
+      unsigned int nbSlabs = 0 );
     
     
 
@@ -834,6 +1110,92 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Tracks all the pieces of boundary components whose bels have
+       their coordinate along the last axis in [zBegin,zEnd). Used by
+       extractAllConnectedSCellParallel.
+
+       @param aSCells (modified) the bels of the pieces are appended.
+       @param aOffsets (modified) the end of each piece is appended.
+       @param aLinks (modified) pairs (piece, bel) such that bel is
+       adjacent to the piece but outside the slab.
+       @param marker the shared marker of visited bels.
+       @param aKSpace any bounded space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp the predicate describing the shape.
+       @param zBegin the first coordinate of the slab.
+       @param zEnd the coordinate after the last of the slab.
+    */
+    template <typename PointPredicate >
+    static 
+    void trackSlabBoundaries
+    ( std::vector<SCell> & aSCells,
+      std::vector<std::size_t> & aOffsets,
+      std::vector< std::pair<std::size_t, SCell> > & aLinks,
+      DenseSurfelMarker<KSpace> & marker,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      Integer zBegin, Integer zEnd );
+
+    /**
+       Tracks all the pieces of 2D contours whose bels have their
+       coordinate along the last axis in [zBegin,zEnd). Each piece is
+       ordered along the direct orientation. Used by
+       extractAll2DSCellContoursParallel.
+
+       @param aSCells (modified) the bels of the pieces are appended.
+       @param aOffsets (modified) the end of each piece is appended.
+       @param aNext (modified) for each piece, 0 if the contour ends
+       with the piece, 1 if the piece is a closed contour, 2 if the
+       contour continues in another slab.
+       @param aNextSCell (modified) for each piece, the bel following
+       the piece in another slab (meaningful if aNext is 2).
+       @param aHasPrev (modified) for each piece, 'true' iff the bel
+       preceding the piece is in another slab.
+       @param marker the shared marker of visited bels.
+       @param aKSpace any bounded space of dimension 2.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp the predicate describing the shape.
+       @param zBegin the first coordinate of the slab.
+       @param zEnd the coordinate after the last of the slab.
+    */
+    template <typename PointPredicate >
+    static 
+    void trackSlab2DContours
+    ( std::vector<SCell> & aSCells,
+      std::vector<std::size_t> & aOffsets,
+      std::vector<unsigned char> & aNext,
+      std::vector<SCell> & aNextSCell,
+      std::vector<bool> & aHasPrev,
+      DenseSurfelMarker<KSpace> & marker,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      Integer zBegin, Integer zEnd );
+
+    /**
+       Computes the bounds of [nbSlabs] slabs of bels along the last
+       axis of [aKSpace].
+
+       @param aKSpace any bounded space.
+       @param nbSlabs the wanted number of slabs, 0 for one per thread.
+       @return the nbSlabs+1 bounds of the slabs (maybe less slabs
+       than asked if the space is thin).
+    */
+    static
+    std::vector<Integer> slabBounds( const KSpace & aKSpace,
+                                     unsigned int nbSlabs );
+
+    /**
+       Union-find: returns the root of [i] with path halving.
+       @param parent the forest of the union-find.
+       @param i any index.
+       @return the root of [i].
+    */
+    static
+    std::size_t findRoot( std::vector<std::size_t> & parent, std::size_t i );
+
   }; // end of class Surfaces
 
 
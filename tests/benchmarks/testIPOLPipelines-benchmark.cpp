@@ -0,0 +1,583 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIPOLPipelines-benchmark.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the pipelines of the IPOL demos (contour extraction,
+ * Fréchet simplification) and of VoronoiMap, on synthetic shapes and
+ * on the sample images, at several sizes.
+ *
+ * For each run, the wall time, the number and size of the heap
+ * allocations, the peak of heap memory and the peak resident set
+ * size are written in JSON format, on the standard output or in the
+ * file given as first argument. The second argument limits the
+ * number of sizes of the synthetic shapes (3 by default). The traces
+ * are written on the standard error.
+ *
+ * Usage: testIPOLPipelines-benchmark [output.json [nbSizes]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <new>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "ConfigTest.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/BatchSimplification.h"
+#include "DGtal/geometry/curves/MinimumVertexSimplification.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+
+#if ( (defined(UNIX)||defined(unix)||defined(linux)) )
+#include <sys/resource.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Heap allocations
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /**
+   * Statistics of the heap allocations, updated by the replaced
+   * operators new and delete below.
+   */
+  struct AllocationStats
+  {
+    DGtal::uint64_t allocations;
+    DGtal::uint64_t allocatedBytes;
+    DGtal::uint64_t liveBytes;
+    DGtal::uint64_t peakBytes;
+  };
+
+  AllocationStats allocationStats = { 0, 0, 0, 0 };
+
+  /// Size of the block header storing the size of the block
+  /// (keeps the alignment of malloc).
+  const std::size_t headerSize = 16;
+
+  void recordAllocation( const std::size_t size )
+  {
+#ifdef WITH_OPENMP
+#pragma omp critical (allocationStats)
+#endif
+    {
+      allocationStats.allocations++;
+      allocationStats.allocatedBytes += size;
+      allocationStats.liveBytes += size;
+      if ( allocationStats.liveBytes > allocationStats.peakBytes )
+        allocationStats.peakBytes = allocationStats.liveBytes;
+    }
+  }
+
+  void recordDeallocation( const std::size_t size )
+  {
+#ifdef WITH_OPENMP
+#pragma omp critical (allocationStats)
+#endif
+    allocationStats.liveBytes -= size;
+  }
+}
+
+void* operator new( std::size_t size )
+{
+  char* block = static_cast<char*>( std::malloc( size + headerSize ) );
+  if ( block == 0 )
+    throw std::bad_alloc();
+  *reinterpret_cast<std::size_t*>( block ) = size;
+  recordAllocation( size );
+  return block + headerSize;
+}
+
+void operator delete( void* ptr ) throw()
+{
+  if ( ptr == 0 )
+    return;
+  char* block = static_cast<char*>( ptr ) - headerSize;
+  recordDeallocation( *reinterpret_cast<std::size_t*>( block ) );
+  std::free( block );
+}
+
+void* operator new[]( std::size_t size )
+{
+  return operator new( size );
+}
+
+void operator delete[]( void* ptr ) throw()
+{
+  operator delete( ptr );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Measures
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Resets the peak resident set size of the process (Linux only).
+ * @return 'true' if the peak has been reset.
+ */
+bool resetPeakRSS()
+{
+  std::ofstream clearRefs( "/proc/self/clear_refs" );
+  if ( ! clearRefs.good() )
+    return false;
+  clearRefs << "5";
+  return clearRefs.good();
+}
+
+/**
+ * @return the peak resident set size of the process in kB, or -1 if
+ * it is not available.
+ */
+long peakRSS()
+{
+  std::ifstream status( "/proc/self/status" );
+  std::string line;
+  while ( std::getline( status, line ) )
+    if ( line.compare( 0, 6, "VmHWM:" ) == 0 )
+      return std::atol( line.c_str() + 6 );
+#if ( (defined(UNIX)||defined(unix)||defined(linux)) )
+  struct rusage usage;
+  if ( getrusage( RUSAGE_SELF, &usage ) == 0 )
+    return usage.ru_maxrss;
+#endif
+  return -1;
+}
+
+/**
+ * Measures of one run of a pipeline.
+ */
+struct BenchmarkRecord
+{
+  std::string pipeline;
+  std::string input;
+  unsigned int size;
+  DGtal::uint64_t nbInputElements;
+  DGtal::uint64_t nbOutputElements;
+  double wallTimeMs;
+  DGtal::uint64_t allocations;
+  DGtal::uint64_t allocatedBytes;
+  DGtal::uint64_t peakHeapBytes;
+  long peakRSSKb;
+  bool peakRSSReset;
+};
+
+/**
+ * Measures the wall time, the allocations and the memory peaks
+ * between start() and stop().
+ */
+class Measure
+{
+public:
+  Measure( const std::string & pipeline, const std::string & input,
+           const unsigned int size, const DGtal::uint64_t nbInputElements )
+  {
+    myRecord.pipeline = pipeline;
+    myRecord.input = input;
+    myRecord.size = size;
+    myRecord.nbInputElements = nbInputElements;
+    myRecord.nbOutputElements = 0;
+  }
+
+  void start()
+  {
+    myRecord.peakRSSReset = resetPeakRSS();
+    myLiveBytes = allocationStats.liveBytes;
+    allocationStats.allocations = 0;
+    allocationStats.allocatedBytes = 0;
+    allocationStats.peakBytes = allocationStats.liveBytes;
+    myClock.startClock();
+  }
+
+  void stop( const DGtal::uint64_t nbOutputElements )
+  {
+    myRecord.wallTimeMs = myClock.stopClock();
+    myRecord.allocations = allocationStats.allocations;
+    myRecord.allocatedBytes = allocationStats.allocatedBytes;
+    myRecord.peakHeapBytes = allocationStats.peakBytes - myLiveBytes;
+    myRecord.nbOutputElements = nbOutputElements;
+    myRecord.peakRSSKb = peakRSS();
+    trace.info() << myRecord.pipeline << " " << myRecord.input
+                 << " (" << myRecord.size << "): " << myRecord.wallTimeMs
+                 << " ms, " << myRecord.allocations << " allocations, "
+                 << myRecord.peakHeapBytes << " bytes" << std::endl;
+  }
+
+  const BenchmarkRecord & record() const
+  {
+    return myRecord;
+  }
+
+private:
+  BenchmarkRecord myRecord;
+  DGtal::uint64_t myLiveBytes;
+  Clock myClock;
+};
+
+/**
+ * Writes the records in JSON format.
+ */
+void writeJSON( std::ostream & out, const std::vector<BenchmarkRecord> & records )
+{
+  out << "{" << std::endl
+      << "  \"benchmark\": \"IPOLPipelines\"," << std::endl
+      << "  \"dgtalVersion\": \"" << DGTAL_VERSION << "\"," << std::endl
+#ifdef WITH_OPENMP
+      << "  \"openmp\": true," << std::endl
+#else
+      << "  \"openmp\": false," << std::endl
+#endif
+      << "  \"results\": [" << std::endl;
+  for ( unsigned int i = 0; i < records.size(); ++i )
+    {
+      const BenchmarkRecord & r = records[ i ];
+      out << "    { \"pipeline\": \"" << r.pipeline << "\""
+          << ", \"input\": \"" << r.input << "\""
+          << ", \"size\": " << r.size
+          << ", \"nbInputElements\": " << r.nbInputElements
+          << ", \"nbOutputElements\": " << r.nbOutputElements
+          << ", \"wallTimeMs\": " << r.wallTimeMs
+          << ", \"allocations\": " << r.allocations
+          << ", \"allocatedBytes\": " << r.allocatedBytes
+          << ", \"peakHeapBytes\": " << r.peakHeapBytes
+          << ", \"peakRSSKb\": " << r.peakRSSKb
+          << ", \"peakRSSReset\": " << ( r.peakRSSReset ? "true" : "false" )
+          << " }" << ( i + 1 < records.size() ? "," : "" ) << std::endl;
+    }
+  out << "  ]" << std::endl
+      << "}" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pipelines
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+typedef std::vector<Z2i::Point>::const_iterator ContourIterator;
+
+/**
+ * Contour extraction of pgm2freeman.
+ */
+void benchPointContours( const Image2D & image, const unsigned char threshold,
+                         const std::string & input, const unsigned int size,
+                         std::vector< std::vector<Z2i::Point> > & contours,
+                         std::vector<BenchmarkRecord> & records )
+{
+  Z2i::KSpace K;
+  K.init( image.domain().lowerBound(), image.domain().upperBound(), true );
+  SurfelAdjacency<2> sAdj( true );
+  SimpleThresholdForegroundPredicate<Image2D> predicate( image, threshold );
+
+  Measure measure( "extractAllPointContours4C", input, size, image.domain().size() );
+  measure.start();
+  Surfaces<Z2i::KSpace>::extractAllPointContours4C( contours, K, predicate, sAdj );
+  measure.stop( contours.size() );
+  records.push_back( measure.record() );
+}
+
+/**
+ * Boundary extraction of extract3D (nested and flat versions).
+ */
+template <typename Image>
+void benchConnectedSCell( const Image & image, const unsigned char threshold,
+                          const std::string & input, const unsigned int size,
+                          std::vector<BenchmarkRecord> & records )
+{
+  typedef typename Image::Domain Domain;
+  typedef KhalimskySpaceND<Domain::dimension, typename Domain::Integer> KSpace;
+  typedef typename KSpace::SCell SCell;
+  KSpace K;
+  K.init( image.domain().lowerBound(), image.domain().upperBound(), true );
+  SurfelAdjacency<Domain::dimension> sAdj( true );
+  SimpleThresholdForegroundPredicate<Image> predicate( image, threshold );
+
+  {
+    std::vector< std::vector<SCell> > components;
+    Measure measure( "extractAllConnectedSCell", input, size, image.domain().size() );
+    measure.start();
+    Surfaces<KSpace>::extractAllConnectedSCell( components, K, sAdj, predicate );
+    DGtal::uint64_t nbBels = 0;
+    for ( unsigned int i = 0; i < components.size(); ++i )
+      nbBels += components[ i ].size();
+    measure.stop( nbBels );
+    records.push_back( measure.record() );
+  }
+  {
+    std::vector<SCell> bels;
+    std::vector<std::size_t> offsets;
+    Measure measure( "extractAllConnectedSCell-flat", input, size, image.domain().size() );
+    measure.start();
+    Surfaces<KSpace>::extractAllConnectedSCell( bels, offsets, K, sAdj, predicate );
+    measure.stop( bels.size() );
+    records.push_back( measure.record() );
+  }
+}
+
+/**
+ * Simplification of frechetSimplification, on all the contours.
+ */
+template <typename SegmentComputer>
+void benchFrechet( const std::string & name,
+                   const std::vector< std::vector<Z2i::Point> > & contours,
+                   const int error, const std::string & input,
+                   const unsigned int size, std::vector<BenchmarkRecord> & records )
+{
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  DGtal::uint64_t nbPoints = 0;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    nbPoints += contours[ i ].size();
+
+  Measure measure( name, input, size, nbPoints );
+  DGtal::uint64_t nbSegments = 0;
+  measure.start();
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      if ( contours[ i ].size() < 2 )
+        continue;
+      Segmentation segmentation( contours[ i ].begin(), contours[ i ].end(),
+                                 SegmentComputer( error ) );
+      for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        nbSegments++;
+    }
+  measure.stop( nbSegments );
+  records.push_back( measure.record() );
+}
+
+/**
+ * Simplification of all the contours with BatchSimplification.
+ */
+void benchBatchFrechet( const std::vector< std::vector<Z2i::Point> > & contours,
+                        const int error, const std::string & input,
+                        const unsigned int size, std::vector<BenchmarkRecord> & records )
+{
+  typedef FlatFrechetShortcut<ContourIterator, int> SegmentComputer;
+  DGtal::uint64_t nbPoints = 0;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    nbPoints += contours[ i ].size();
+
+  Measure measure( "BatchSimplification<FlatFrechetShortcut>", input, size, nbPoints );
+  SegmentComputer computer( error );
+  BatchSimplification<SegmentComputer> batch( computer );
+  measure.start();
+  batch.simplify( contours );
+  measure.stop( batch.vertices().size() );
+  records.push_back( measure.record() );
+}
+
+/**
+ * Simplification with a minimal number of vertices, to be compared
+ * with the greedy one (number of segments and time).
+ */
+void benchMinimumFrechet( const std::vector< std::vector<Z2i::Point> > & contours,
+                          const int error, const unsigned int window,
+                          const std::string & input, const unsigned int size,
+                          std::vector<BenchmarkRecord> & records )
+{
+  typedef FlatFrechetShortcut<ContourIterator, int> SegmentComputer;
+  typedef MinimumVertexSimplification<SegmentComputer> Simplification;
+  DGtal::uint64_t nbPoints = 0;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    nbPoints += contours[ i ].size();
+
+  std::ostringstream name;
+  name << "MinimumVertexSimplification<FlatFrechetShortcut>";
+  if ( window != 0 )
+    name << "-window" << window;
+  Measure measure( name.str(), input, size, nbPoints );
+  SegmentComputer computer( error );
+  DGtal::uint64_t nbSegments = 0;
+  measure.start();
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      if ( contours[ i ].size() < 2 )
+        continue;
+      Simplification simplification( contours[ i ].begin(), contours[ i ].end(),
+                                     computer, window );
+      nbSegments += simplification.size();
+    }
+  measure.stop( nbSegments );
+  records.push_back( measure.record() );
+}
+
+/**
+ * Euclidean Voronoi map of the background (value below the
+ * threshold).
+ */
+template <typename Image>
+void benchVoronoiMap( const Image & image, const unsigned char threshold,
+                      const std::string & input, const unsigned int size,
+                      std::vector<BenchmarkRecord> & records )
+{
+  typedef typename Image::Domain::Space Space;
+  typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+  typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef VoronoiMap<Space, Predicate, L2Metric> Voronoi;
+  L2Metric l2;
+  Predicate predicate( image, threshold );
+
+  Measure measure( "VoronoiMap", input, size, image.domain().size() );
+  measure.start();
+  Voronoi voronoi( image.domain(), predicate, l2 );
+  measure.stop( image.domain().size() );
+  records.push_back( measure.record() );
+}
+
+/**
+ * All the 2D pipelines on an image.
+ */
+void bench2D( const Image2D & image, const unsigned char threshold,
+              const std::string & input, const unsigned int size,
+              std::vector<BenchmarkRecord> & records )
+{
+  trace.beginBlock( "2D pipelines: " + input );
+  std::vector< std::vector<Z2i::Point> > contours;
+  benchPointContours( image, threshold, input, size, contours, records );
+  benchConnectedSCell( image, threshold, input, size, records );
+  benchFrechet< FrechetShortcut<ContourIterator, int> >
+    ( "GreedySegmentation<FrechetShortcut>", contours, 2, input, size, records );
+  benchFrechet< FlatFrechetShortcut<ContourIterator, int> >
+    ( "GreedySegmentation<FlatFrechetShortcut>", contours, 2, input, size, records );
+  benchBatchFrechet( contours, 2, input, size, records );
+  benchMinimumFrechet( contours, 2, 0, input, size, records );
+  benchMinimumFrechet( contours, 2, 64, input, size, records );
+  benchVoronoiMap( image, threshold, input, size, records );
+  trace.endBlock();
+}
+
+/**
+ * All the 3D pipelines on an image.
+ */
+void bench3D( const Image3D & image, const unsigned char threshold,
+              const std::string & input, const unsigned int size,
+              std::vector<BenchmarkRecord> & records )
+{
+  trace.beginBlock( "3D pipelines: " + input );
+  benchConnectedSCell( image, threshold, input, size, records );
+  benchVoronoiMap( image, threshold, input, size, records );
+  trace.endBlock();
+}
+
+/**
+ * @return an image of the digitization of @a shape (255 inside, 0
+ * outside), on the domain [-halfExtent-2, halfExtent+2]^d.
+ */
+template <typename Image, typename Shape>
+Image digitize( const Shape & shape, const int halfExtent )
+{
+  typedef typename Image::Domain Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  Domain domain( Image::Point::diagonal( -halfExtent - 2 ),
+                 Image::Point::diagonal( halfExtent + 2 ) );
+  DigitalSet set( domain );
+  Shapes<Domain>::euclideanShaper( set, shape );
+  Image image( domain );
+  for ( typename DigitalSet::ConstIterator it = set.begin(), itEnd = set.end();
+        it != itEnd; ++it )
+    image.setValue( *it, 255 );
+  return image;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of the IPOL pipelines" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int nbSizes = ( argc > 2 ) ? std::atoi( argv[ 2 ] ) : 3;
+  std::vector<BenchmarkRecord> records;
+
+  //Synthetic shapes (the size of a run is the diameter of the shape)
+  int radius = 48;
+  for ( unsigned int s = 0; s < nbSizes; ++s, radius *= 4 )
+    {
+      Flower2D<Z2i::Space> flower( 0.0, 0.0, radius, radius / 3.0, 5, 0.0 );
+      Image2D image = digitize<Image2D>( flower, radius + radius / 3 + 1 );
+      bench2D( image, 0, "flower", 2 * radius, records );
+    }
+  radius = 16;
+  for ( unsigned int s = 0; s < nbSizes; ++s, radius *= 2 )
+    {
+      ImplicitBall<Z3i::Space> ball( Z3i::RealPoint( 0.0, 0.0, 0.0 ), radius );
+      Image3D image = digitize<Image3D>( ball, radius );
+      bench3D( image, 0, "ball", 2 * radius, records );
+    }
+
+  //Sample images
+  const char * samples2D[] = { "circleR10.pgm", "contourS.pgm",
+                               "church-small.pgm", "klokanNoise0_75_125_175.pgm" };
+  for ( unsigned int i = 0; i < 4; ++i )
+    {
+      Image2D image = PNMReader<Image2D>::importPGM( testPath + "samples/" + samples2D[ i ] );
+      Z2i::Vector extent = image.domain().upperBound() - image.domain().lowerBound();
+      bench2D( image, 128, samples2D[ i ], extent[ 0 ] + 1, records );
+    }
+  Image3D cat = VolReader<Image3D>::importVol( testPath + "samples/cat10.vol" );
+  Z3i::Vector extent = cat.domain().upperBound() - cat.domain().lowerBound();
+  bench3D( cat, 0, "cat10.vol", extent[ 0 ] + 1, records );
+
+  bool res = true;
+  if ( argc > 1 )
+    {
+      std::ofstream out( argv[ 1 ] );
+      writeJSON( out, records );
+      res = out.good();
+    }
+  else
+    writeJSON( std::cout, records );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIncrementalMostCenteredMSEstimator.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class IncrementalMostCenteredMaximalSegmentEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/IncrementalMostCenteredMaximalSegmentEstimator.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IncrementalMostCenteredMaximalSegmentEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point>::const_iterator Iterator;
+typedef ArithmeticalDSS<Circulator<Iterator>, int, 4> SegmentComputer;
+typedef TangentVectorFromDSSEstimator<SegmentComputer> SCEstimator;
+typedef SCEstimator::Quantity Quantity;
+typedef IncrementalMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+
+/**
+ * @return 'true' if the quantities are the ones of
+ * MostCenteredMaximalSegmentEstimator on the whole curve.
+ */
+bool sameAsMostCentered( const Estimator & estimator )
+{
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Reference;
+  SegmentComputer sc;
+  SCEstimator f;
+  Reference reference( sc, f );
+  const Circulator<Iterator> c = estimator.cover().circulator( 0 );
+  reference.init( 1, c, c );
+  std::vector<Quantity> q;
+  reference.eval( c, c, std::back_inserter( q ) );
+  return q == estimator.quantities();
+}
+
+bool testIncrementalMostCenteredMSEstimator( const std::string & filename )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Tangents of " + filename + " ..." );
+  std::fstream fst;
+  fst.open( ( testPath + filename ).c_str(), std::ios::in );
+  FreemanChain<int> chain( fst );
+  SegmentComputer sc;
+  SCEstimator f;
+  Estimator estimator( sc, f );
+  estimator.init( 1, chain );
+  nbok += ( estimator.isValid() && sameAsMostCentered( estimator ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << estimator << std::endl;
+
+  //every code is replaced by a bump, the bump is then removed
+  unsigned int nbEditsOk = 0;
+  unsigned int nbEdits = 0;
+  unsigned int nbRefreshed = 0;
+  for ( unsigned int i = 1; i + 1 < chain.size(); i += chain.size() / 20 )
+    {
+      const std::string codes = estimator.cover().codes();
+      if ( ( codes[ i-1 ] != codes[ i ] ) || ( codes[ i ] != codes[ i+1 ] ) )
+        continue;
+      std::string bump;
+      bump += FreemanChain<int>::addToCode( codes[ i ], 1 );
+      bump += codes[ i ];
+      bump += FreemanChain<int>::addToCode( codes[ i ], 3 );
+      estimator.splice( i, i + 1, bump );
+      nbRefreshed += estimator.nbRefreshed();
+      bool ok = estimator.isValid() && sameAsMostCentered( estimator );
+      estimator.splice( i, i + 3, codes.substr( i, 1 ) );
+      nbRefreshed += estimator.nbRefreshed();
+      ok = ok && sameAsMostCentered( estimator ) && ( estimator.cover().codes() == codes );
+      nbEditsOk += ok ? 1 : 0;
+      nbEdits++;
+    }
+  nbok += ( ( nbEdits > 0 ) && ( nbEditsOk == nbEdits ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbEditsOk << "/" << nbEdits
+               << " edits, " << nbRefreshed << " quantities estimated" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IncrementalMostCenteredMaximalSegmentEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testIncrementalMostCenteredMSEstimator( "samples/klokan.fc" )
+    && testIncrementalMostCenteredMSEstimator( "samples/rsquareNoise0_75_125_175.fc" ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchSimplification.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class BatchSimplification.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/BatchSimplification.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/io/writers/BinaryContoursWriter.h"
+#include "DGtal/io/readers/BinaryContoursReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchSimplification.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point> Contour;
+typedef Contour::const_iterator ConstIterator;
+
+/**
+ * @return the first point of each segment of the greedy segmentation.
+ */
+template <typename SegmentComputer>
+Contour greedyVertices( const Contour & contour, const SegmentComputer & computer )
+{
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  Contour vertices;
+  if ( contour.size() < 2 )
+    return contour;
+  Segmentation segmentation( contour.begin(), contour.end(), computer );
+  for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    vertices.push_back( *( it->begin() ) );
+  return vertices;
+}
+
+/**
+ * @return 'true' if the simplification of each contour is its greedy
+ * segmentation.
+ */
+template <typename Batch>
+bool sameAsGreedy( const Batch & batch, const std::vector<Contour> & contours,
+                   const typename Batch::SegmentComputer & computer )
+{
+  if ( ! batch.isValid() || ( batch.nbContours() != contours.size() ) )
+    return false;
+  Contour polygon;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      batch.getVertices( i, polygon );
+      if ( ( polygon != greedyVertices( contours[ i ], computer ) )
+           || ( batch.statistics()[ i ].nbPoints != contours[ i ].size() ) )
+        return false;
+    }
+  return true;
+}
+
+/**
+ * Contours of the samples, cut into pieces of various sizes, with an
+ * empty contour and a single point.
+ */
+std::vector<Contour> makeContours()
+{
+  std::vector<Contour> contours;
+  const char* samples[] = { "samples/klokan.sdp", "samples/france.sdp",
+                            "samples/rsquareNoise0_75_125_175.sdp" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      Contour contour =
+        PointListReader<Point>::getPointsFromFile( testPath + samples[ i ] );
+      contours.push_back( contour );
+      unsigned int size = 3;
+      for ( unsigned int start = 0; start < contour.size(); start += size, size = 2 * size + 1 )
+        contours.push_back( Contour( contour.begin() + start,
+                                     contour.begin() + std::min<std::size_t>( start + size, contour.size() ) ) );
+    }
+  contours.push_back( Contour() );
+  contours.push_back( Contour( 1, Point( 4, 2 ) ) );
+  return contours;
+}
+
+bool testBatchSimplification()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Simplification of a vector of contours ..." );
+  std::vector<Contour> contours = makeContours();
+  typedef FlatFrechetShortcut<ConstIterator, int> SegmentComputer;
+  const double errors[] = { 1, 3 };
+  for ( unsigned int j = 0; j < 2; ++j )
+    {
+      SegmentComputer computer( errors[ j ] );
+      BatchSimplification<SegmentComputer> batch( computer );
+      batch.simplify( contours );
+      trace.info() << batch << std::endl;
+      nbok += sameAsGreedy( batch, contours, computer ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "same vertices as GreedySegmentation" << std::endl;
+
+      // the Frechet distance is bounded by the error
+      bool bounded = true;
+      for ( unsigned int i = 0; i < contours.size(); ++i )
+        bounded = bounded && ( batch.statistics()[ i ].maxDistance <= errors[ j ] )
+          && ( batch.statistics()[ i ].cpuTime >= 0.0 );
+      nbok += bounded ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "distances lower than " << errors[ j ] << std::endl;
+    }
+
+  // with FrechetShortcut, in width only mode
+  typedef FrechetShortcut<ConstIterator, int> ReferenceSegmentComputer;
+  ReferenceSegmentComputer reference( 2, true );
+  BatchSimplification<ReferenceSegmentComputer> referenceBatch( reference );
+  referenceBatch.simplify( contours );
+  nbok += sameAsGreedy( referenceBatch, contours, reference ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FrechetShortcut, width only" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Simplification of flat and binary contours ..." );
+  Contour points;
+  std::vector<std::size_t> offsets( 1, 0 );
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      points.insert( points.end(), contours[ i ].begin(), contours[ i ].end() );
+      offsets.push_back( points.size() );
+    }
+  SegmentComputer computer( 2 );
+  BatchSimplification<SegmentComputer> batch( computer );
+  batch.simplify( points, offsets );
+  nbok += sameAsGreedy( batch, contours, computer ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flat contours" << std::endl;
+  Contour vertices = batch.vertices();
+  std::vector<std::size_t> vertexOffsets = batch.offsets();
+
+  BinaryContoursWriter::exportPointContours( "testBatchSimplification.bin", contours );
+  BinaryContoursReader<Point> reader( "testBatchSimplification.bin" );
+  batch.simplifyAll( reader );
+  nbok += ( sameAsGreedy( batch, contours, computer )
+            && ( batch.vertices() == vertices )
+            && ( batch.offsets() == vertexOffsets ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "binary contours" << std::endl;
+
+  // Freeman chains of the file are decoded by the threads
+  std::vector<Contour> chainContours;
+  BinaryContoursWriter writer;
+  writer.open( "testBatchSimplificationFC.bin", BinaryContoursFormat::FREEMAN_CHAINS );
+  const char* chains[] = { "samples/klokan.fc", "samples/france.fc", "samples/manche.fc" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::fstream fst;
+      fst.open( ( testPath + chains[ i ] ).c_str(), std::ios::in );
+      FreemanChain<int> fc( fst );
+      writer.addFreemanChain( fc );
+      Contour contour;
+      FreemanChain<int>::getContourPoints( fc, contour );
+      chainContours.push_back( contour );
+    }
+  writer.close();
+  BinaryContoursReader<Point> chainReader( "testBatchSimplificationFC.bin" );
+  batch.simplifyAll( chainReader );
+  nbok += sameAsGreedy( batch, chainContours, computer ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Freeman chains " << batch << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchSimplification" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBatchSimplification(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
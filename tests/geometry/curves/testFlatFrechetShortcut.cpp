@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatFrechetShortcut.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class FlatFrechetShortcut.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/io/boards/Board2D.h"
+#include "DGtal/io/boards/CDrawableWithBoard2D.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FlatFrechetShortcut.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point>::const_iterator ConstIterator;
+
+void testFlatFrechetShortcutConceptChecking()
+{
+  typedef FlatFrechetShortcut<ConstIterator,int> Shortcut;
+  BOOST_CONCEPT_ASSERT(( CDrawableWithBoard2D<Shortcut> ));
+  BOOST_CONCEPT_ASSERT(( CForwardSegmentComputer<Shortcut> ));
+}
+
+/**
+ * Greedy segmentation of a range of points.
+ * @return the first point of each shortcut, and the time in ms.
+ */
+template <typename SegmentComputer, typename Iterator>
+double greedyVertices( Iterator itb, Iterator ite, const SegmentComputer & computer,
+                       std::vector<Point> & vertices )
+{
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  vertices.clear();
+  clock_t time1 = clock();
+  Segmentation segmentation( itb, ite, computer );
+  for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    vertices.push_back( *( it->begin() ) );
+  clock_t time2 = clock();
+  return ( (double) time2 - (double) time1 ) / ( (double) CLOCKS_PER_SEC / 1000 );
+}
+
+/**
+ * Compares the greedy segmentations of FrechetShortcut and
+ * FlatFrechetShortcut.
+ */
+bool testSameSegmentation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Same greedy segmentation as FrechetShortcut ..." );
+  const char* samples[] = { "samples/klokan.sdp", "samples/france.sdp",
+                            "samples/rsquareNoise0_75_125_175.sdp" };
+  const double errors[] = { 1, 2, 3, 5, 8 };
+  double time = 0;
+  double flatTime = 0;
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::vector<Point> contour =
+        PointListReader<Point>::getPointsFromFile( testPath + samples[ i ] );
+      for ( unsigned int j = 0; j < 5; ++j )
+        for ( unsigned int w = 0; w < 2; ++w )
+          {
+            std::vector<Point> vertices;
+            std::vector<Point> flatVertices;
+            time += greedyVertices( contour.begin(), contour.end(),
+                                    FrechetShortcut<ConstIterator,int>( errors[ j ], w == 1 ),
+                                    vertices );
+            flatTime += greedyVertices( contour.begin(), contour.end(),
+                                        FlatFrechetShortcut<ConstIterator,int>( errors[ j ], w == 1 ),
+                                        flatVertices );
+            nbok += ( vertices == flatVertices ) ? 1 : 0;
+            nb++;
+            trace.info() << "(" << nbok << "/" << nb << ") " << samples[ i ]
+                         << " error=" << errors[ j ] << ( w == 1 ? " width only" : "" )
+                         << " " << contour.size() << " points -> "
+                         << flatVertices.size() << " vertices" << std::endl;
+          }
+    }
+  trace.info() << "FrechetShortcut: " << time << " ms, FlatFrechetShortcut: "
+               << flatTime << " ms" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Segmentation of a grid curve and drawing.
+ */
+bool testGridCurve()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Greedy segmentation of a grid curve ..." );
+  std::vector<Point> contour =
+    PointListReader<Point>::getPointsFromFile( testPath + "samples/klokan.sdp" );
+  Curve aCurve;
+  aCurve.initFromVector( contour );
+  Curve::PointsRange r = aCurve.getPointsRange();
+  typedef Curve::PointsRange::ConstIterator Iterator;
+  std::vector<Point> vertices;
+  std::vector<Point> flatVertices;
+  greedyVertices( r.begin(), r.end(), FrechetShortcut<Iterator,int>( 3 ), vertices );
+  greedyVertices( r.begin(), r.end(), FlatFrechetShortcut<Iterator,int>( 3 ), flatVertices );
+  nbok += ( vertices == flatVertices ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << flatVertices.size() << " vertices" << std::endl;
+
+  typedef FlatFrechetShortcut<Iterator,int> SegmentComputer;
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  Segmentation segmentation( r.begin(), r.end(), SegmentComputer( 3 ) );
+  Board2D board;
+  board << r;
+  for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    board << *it;
+  board.saveEPS( "FlatFrechetShortcutGreedySegmentationTest.eps" );
+
+  // a shortcut is not modified by isExtendableForward()
+  SegmentComputer s( 3 );
+  s.init( r.begin() );
+  while ( ( s.end() != r.end() ) && s.isExtendableForward() )
+    s.extendForward();
+  nbok += ( s.end() == segmentation.begin()->end() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << s << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FlatFrechetShortcut" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  testFlatFrechetShortcutConceptChecking();
+
+  bool res = testSameSegmentation() && testGridCurve(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMaximalSegmentCover.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class MaximalSegmentCover.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/MaximalSegmentCover.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MaximalSegmentCover.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point>::const_iterator Iterator;
+typedef ArithmeticalDSS<Circulator<Iterator>, int, 4> SegmentComputer;
+typedef MaximalSegmentCover<SegmentComputer> Cover;
+typedef FreemanChain<int> Chain;
+
+/**
+ * Chooses a local edit of the codes: the codes [first,last) are
+ * replaced by sorted codes (an L-shaped path), a bump or the removal
+ * of a bump.
+ * @return the new codes.
+ */
+std::string randomEdit( const std::string & codes, unsigned int & first, unsigned int & last )
+{
+  const unsigned int n = codes.size();
+  for ( ; ; )
+    {
+      const unsigned int i = 1 + rand() % ( n - 4 );
+      const int type = rand() % 3;
+      if ( type == 0 )
+        {
+          first = i;
+          last = std::min( n, i + 2 + rand() % 8 );
+          std::string s = codes.substr( first, last - first );
+          const bool opposite =
+            ( ( s.find( '0' ) != std::string::npos ) && ( s.find( '2' ) != std::string::npos ) )
+            || ( ( s.find( '1' ) != std::string::npos ) && ( s.find( '3' ) != std::string::npos ) );
+          if ( ! opposite )
+            {
+              std::sort( s.begin(), s.end() );
+              return s;
+            }
+        }
+      else if ( ( type == 1 ) && ( codes[ i-1 ] == codes[ i ] ) && ( codes[ i ] == codes[ i+1 ] ) )
+        {
+          first = i;
+          last = i + 1;
+          std::string s;
+          s += Chain::addToCode( codes[ i ], 1 );
+          s += codes[ i ];
+          s += Chain::addToCode( codes[ i ], 3 );
+          return s;
+        }
+      else if ( ( type == 2 ) && ( codes[ i ] == Chain::addToCode( codes[ i+1 ], 1 ) )
+                && ( codes[ i+2 ] == Chain::addToCode( codes[ i+1 ], 3 ) ) )
+        {
+          first = i;
+          last = i + 3;
+          return codes.substr( i + 1, 1 );
+        }
+    }
+}
+
+/**
+ * @return 'true' if the cover has the same segments as a cover
+ * computed from scratch.
+ */
+bool sameAsNewCover( const Cover & cover )
+{
+  Cover other;
+  other.init( cover.chain() );
+  return ( cover.points() == other.points() )
+    && ( cover.extents() == other.extents() );
+}
+
+bool testMaximalSegmentCover( const std::string & filename )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Maximal segments of " + filename + " ..." );
+  std::fstream fst;
+  fst.open( ( testPath + filename ).c_str(), std::ios::in );
+  Chain chain( fst );
+  Cover cover;
+  cover.init( chain );
+  trace.info() << cover << std::endl;
+
+  //same segments as the saturated segmentation
+  typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+  std::vector<Cover::Extent> extents;
+  Segmentation segmentation( cover.circulator( 0 ), cover.circulator( 0 ), SegmentComputer() );
+  for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    {
+      const unsigned int b = it->begin().base() - cover.points().begin();
+      const unsigned int e = it->end().base() - cover.points().begin();
+      extents.push_back( Cover::Extent( b, ( e + cover.nbPoints() - b ) % cover.nbPoints() ) );
+    }
+  std::sort( extents.begin(), extents.end() );
+  nbok += ( ( extents == cover.extents() ) && ( cover.nbPoints() == chain.size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same segments as SaturatedSegmentation" << std::endl;
+
+  //random edits
+  srand( 0 );
+  const Cover original( cover );
+  unsigned int nbEditsOk = 0;
+  unsigned int nbRecomputed = 0;
+  for ( unsigned int k = 0; k < 50; ++k )
+    {
+      unsigned int first, last;
+      const std::string codes = randomEdit( cover.codes(), first, last );
+      cover.splice( first, last, codes );
+      nbRecomputed += cover.nbRecomputed();
+      nbEditsOk += ( sameAsNewCover( cover ) && ( cover.nbChanged() < cover.nbPoints() / 4 ) ) ? 1 : 0;
+    }
+  nbok += ( nbEditsOk == 50 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbEditsOk << "/50 edits, "
+               << nbRecomputed << " segments recognized, " << cover << std::endl;
+
+  //edits at the ends of the chain, an insertion and an invalid edit
+  cover = original;
+  const unsigned int n = cover.nbPoints();
+  const std::string begin = cover.codes().substr( 0, 3 );
+  const std::string end = cover.codes().substr( n - 3 );
+  bool ok = true;
+  cover.splice( 0, 3, std::string( begin.rbegin(), begin.rend() ) );
+  ok = ok && sameAsNewCover( cover );
+  cover.splice( n - 3, n, std::string( end.rbegin(), end.rend() ) );
+  ok = ok && sameAsNewCover( cover );
+  cover.splice( n, n, "0123" );
+  ok = ok && sameAsNewCover( cover ) && ( cover.nbPoints() == n + 4 );
+  cover.splice( n, n + 4, "" );
+  ok = ok && ( cover.nbPoints() == n ) && sameAsNewCover( cover );
+  cover.splice( 0, 3, begin );
+  cover.splice( n - 3, n, end );
+  ok = ok && ( cover.codes() == original.codes() ) && ( cover.extents() == original.extents() );
+  bool thrown = false;
+  try
+    {
+      cover.splice( 10, 12, cover.codes().substr( 10, 2 ) + "0" );
+    }
+  catch ( InputException & )
+    {
+      thrown = true;
+    }
+  ok = ok && thrown && ( cover.codes() == original.codes() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "edits at the ends of the chain" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MaximalSegmentCover" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMaximalSegmentCover( "samples/klokan.fc" )
+    && testMaximalSegmentCover( "samples/rsquareNoise0_75_125_175.fc" ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
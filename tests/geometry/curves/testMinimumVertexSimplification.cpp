@@ -0,0 +1,203 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMinimumVertexSimplification.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class MinimumVertexSimplification.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/MinimumVertexSimplification.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MinimumVertexSimplification.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point> Contour;
+typedef Contour::const_iterator ConstIterator;
+typedef FlatFrechetShortcut<ConstIterator, int> SegmentComputer;
+typedef MinimumVertexSimplification<SegmentComputer> Simplification;
+
+/**
+ * @return the number of segments of the greedy segmentation.
+ */
+unsigned int greedySize( const Contour & contour, const SegmentComputer & computer )
+{
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  unsigned int nb = 0;
+  Segmentation segmentation( contour.begin(), contour.end(), computer );
+  for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    nb++;
+  return nb;
+}
+
+/**
+ * @return 'true' if the segment computer accepts [itb,itl].
+ */
+bool isShortcut( const ConstIterator & itb, const ConstIterator & itl,
+                 const SegmentComputer & computer )
+{
+  SegmentComputer s( computer );
+  s.init( itb );
+  while ( s.end() <= itl )
+    if ( ! s.extendForward() )
+      return false;
+  return true;
+}
+
+/**
+ * @return the number of segments of a shortest path of the explicit
+ * graph of the shortcuts of at most [window] points.
+ */
+unsigned int bruteForceSize( const Contour & contour, const SegmentComputer & computer,
+                             unsigned int window )
+{
+  const unsigned int n = contour.size();
+  std::vector<unsigned int> distance( n, n );
+  std::queue<unsigned int> queue;
+  distance[ 0 ] = 0;
+  queue.push( 0 );
+  while ( ! queue.empty() )
+    {
+      unsigned int i = queue.front();
+      queue.pop();
+      for ( unsigned int j = i + 1; ( j < n ) && ( ( window == 0 ) || ( j - i + 1 <= window ) ); ++j )
+        if ( ( distance[ j ] == n )
+             && ( ( j == i + 1 )
+                  || isShortcut( contour.begin() + i, contour.begin() + j, computer ) ) )
+          {
+            distance[ j ] = distance[ i ] + 1;
+            queue.push( j );
+          }
+    }
+  return distance[ n - 1 ];
+}
+
+bool testMinimumVertexSimplification()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Minimal simplification of the samples ..." );
+  const char* samples[] = { "samples/klokan.sdp", "samples/france.sdp",
+                            "samples/rsquareNoise0_75_125_175.sdp" };
+  const double errors[] = { 1, 2, 4 };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      Contour contour =
+        PointListReader<Point>::getPointsFromFile( testPath + samples[ i ] );
+      for ( unsigned int j = 0; j < 3; ++j )
+        {
+          SegmentComputer computer( errors[ j ] );
+          Simplification simplification( contour.begin(), contour.end(), computer );
+          const std::vector<ConstIterator> & v = simplification.vertices();
+          bool ok = ( v.front() == contour.begin() ) && ( v.back() == contour.end() - 1 );
+          for ( unsigned int k = 0; ok && ( k + 1 < v.size() ); ++k )
+            ok = isShortcut( v[ k ], v[ k+1 ], computer );
+          const unsigned int greedy = greedySize( contour, computer );
+          nbok += ( ok && ( simplification.size() <= greedy ) ) ? 1 : 0;
+          nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") " << samples[ i ]
+                       << " error=" << errors[ j ] << " greedy=" << greedy
+                       << " " << simplification << std::endl;
+        }
+    }
+  trace.endBlock();
+
+  trace.beginBlock ( "Comparison with a breadth first search of the whole graph ..." );
+  Contour contour =
+    PointListReader<Point>::getPointsFromFile( testPath + "samples/rsquareNoise0_75_125_175.sdp" );
+  contour.resize( 300 );
+  const unsigned int windows[] = { 0, 5, 12 };
+  for ( unsigned int j = 0; j < 2; ++j )
+    for ( unsigned int w = 0; w < 3; ++w )
+      {
+        SegmentComputer computer( errors[ j ] );
+        Simplification simplification( contour.begin(), contour.end(), computer, windows[ w ] );
+        const std::vector<ConstIterator> & v = simplification.vertices();
+        bool ok = true;
+        for ( unsigned int k = 0; ok && ( k + 1 < v.size() ); ++k )
+          ok = ( windows[ w ] == 0 ) || ( v[ k+1 ] - v[ k ] + 1 <= (int) windows[ w ] );
+        const unsigned int expected = bruteForceSize( contour, computer, windows[ w ] );
+        nbok += ( ok && ( simplification.size() == expected ) ) ? 1 : 0;
+        nb++;
+        trace.info() << "(" << nbok << "/" << nb << ") "
+                     << " error=" << errors[ j ] << " window=" << windows[ w ]
+                     << " expected=" << expected << " " << simplification << std::endl;
+      }
+
+  // with FrechetShortcut, and on short ranges
+  typedef FrechetShortcut<ConstIterator, int> ReferenceSegmentComputer;
+  MinimumVertexSimplification<ReferenceSegmentComputer> reference
+    ( contour.begin(), contour.end(), ReferenceSegmentComputer( 2 ) );
+  Simplification flat( contour.begin(), contour.end(), SegmentComputer( 2 ) );
+  Simplification single( contour.begin(), contour.begin() + 1, SegmentComputer( 2 ) );
+  Simplification empty( contour.begin(), contour.begin(), SegmentComputer( 2 ) );
+  nbok += ( ( reference.size() == flat.size() )
+            && ( single.vertices().size() == 1 ) && ( single.size() == 0 )
+            && ( empty.vertices().empty() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FrechetShortcut and short ranges" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MinimumVertexSimplification" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMinimumVertexSimplification(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
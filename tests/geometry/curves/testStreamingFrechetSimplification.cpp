@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingFrechetSimplification.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class StreamingFrechetSimplification.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <boost/function_output_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/FlatFrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/StreamingFrechetSimplification.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StreamingFrechetSimplification.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<Point> Contour;
+typedef Contour::const_iterator ConstIterator;
+typedef std::back_insert_iterator<Contour> Output;
+typedef StreamingFrechetSimplification<Point, Output> Simplification;
+
+/**
+ * @return the first points of the segments of the greedy
+ * segmentation, followed by the last point.
+ */
+template <typename SegmentComputer>
+Contour greedyVertices( const Contour & contour, const SegmentComputer & computer )
+{
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  Contour vertices;
+  Segmentation segmentation( contour.begin(), contour.end(), computer );
+  for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    vertices.push_back( *( it->begin() ) );
+  vertices.push_back( contour.back() );
+  return vertices;
+}
+
+/**
+ * Callback counting the vertices.
+ */
+struct VertexCounter
+{
+  unsigned int* myNb;
+  VertexCounter( unsigned int* nb ) : myNb( nb ) {}
+  void operator()( const Point & /*p*/ ) const { ++( *myNb ); }
+};
+
+bool testSameAsGreedy()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Same vertices as GreedySegmentation ..." );
+  const char* samples[] = { "samples/klokan.sdp", "samples/france.sdp",
+                            "samples/rsquareNoise0_75_125_175.sdp" };
+  const double errors[] = { 1, 2, 3, 5 };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      Contour contour =
+        PointListReader<Point>::getPointsFromFile( testPath + samples[ i ] );
+      for ( unsigned int j = 0; j < 4; ++j )
+        for ( unsigned int w = 0; w < 2; ++w )
+          {
+            Contour vertices;
+            Simplification simplification( std::back_inserter( vertices ), errors[ j ], w == 1 );
+            for ( ConstIterator it = contour.begin(); it != contour.end(); ++it )
+              simplification.push( *it );
+            simplification.flush();
+            nbok += ( ( vertices == greedyVertices( contour, FrechetShortcut<ConstIterator,int>( errors[ j ], w == 1 ) ) )
+                      && ( vertices == greedyVertices( contour, FlatFrechetShortcut<ConstIterator,int>( errors[ j ], w == 1 ) ) ) ) ? 1 : 0;
+            nb++;
+            trace.info() << "(" << nbok << "/" << nb << ") " << samples[ i ]
+                         << " error=" << errors[ j ] << ( w == 1 ? " width only" : "" )
+                         << " " << vertices.size() << " vertices" << std::endl;
+          }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testStream()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Streams and memory ceiling ..." );
+  const Contour klokan = PointListReader<Point>::getPointsFromFile( testPath + "samples/klokan.sdp" );
+  const Contour france = PointListReader<Point>::getPointsFromFile( testPath + "samples/france.sdp" );
+
+  // two streams, a single point and an empty one, through a callback
+  unsigned int nbVertices = 0;
+  typedef boost::function_output_iterator<VertexCounter> CallbackOutput;
+  StreamingFrechetSimplification<Point, CallbackOutput> counter
+    ( boost::make_function_output_iterator( VertexCounter( &nbVertices ) ), 3 );
+  for ( ConstIterator it = klokan.begin(); it != klokan.end(); ++it )
+    counter.push( *it );
+  counter.flush();
+  for ( ConstIterator it = france.begin(); it != france.end(); ++it )
+    counter.push( *it );
+  trace.info() << counter << std::endl;
+  counter.flush();
+  counter.push( Point( 3, 4 ) );
+  counter.flush();
+  counter.flush();
+  const unsigned int expected =
+    greedyVertices( klokan, FlatFrechetShortcut<ConstIterator,int>( 3 ) ).size()
+    + greedyVertices( france, FlatFrechetShortcut<ConstIterator,int>( 3 ) ).size() + 1;
+  nbok += ( nbVertices == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbVertices << " vertices written by the callback" << std::endl;
+
+  // shortcuts of at most 10 points
+  Contour vertices;
+  Simplification bounded( std::back_inserter( vertices ), 5, false, 10 );
+  bool ok = true;
+  for ( ConstIterator it = france.begin(); it != france.end(); ++it )
+    {
+      bounded.push( *it );
+      ok = ok && bounded.isValid() && ( bounded.length() <= 10 );
+    }
+  bounded.flush();
+  ConstIterator it = france.begin();
+  for ( unsigned int k = 0; ok && ( k + 1 < vertices.size() ); ++k )
+    {
+      ConstIterator next = std::find( it + 1, france.end(), vertices[ k+1 ] );
+      ok = ( *it == vertices[ k ] ) && ( next - it < 10 );
+      it = next;
+    }
+  nbok += ( ok && ( vertices.back() == france.back() )
+            && ( vertices.size() > greedyVertices( france, FlatFrechetShortcut<ConstIterator,int>( 5 ) ).size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << vertices.size() << " vertices with shortcuts of at most 10 points" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class StreamingFrechetSimplification" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSameAsGreedy() && testStream(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
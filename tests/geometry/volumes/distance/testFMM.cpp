@@ -653,6 +653,115 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Indexed heap of candidate points
+ *
+ */
+bool testCandidateHeap(int size)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  static const DGtal::Dimension dimension = 2; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+  trace.beginBlock ( "Indexed heap of candidate points" );
+
+  //insertion, decrease-key and extraction
+  typedef ImageContainerBySTLVector<Domain, unsigned int> SlotImage; 
+  typedef FMMCandidateHeap<SlotImage, double> Heap; 
+  typedef FMMCandidateSet<Point, double> CandidateSet; 
+  Heap heap( d ); 
+  CandidateSet set( d ); 
+  for (int i = 0; i < 200; ++i)
+    {
+      Point p( (i*7) % size, (i*13) % size ); 
+      double v = ( (i*37) % 101 ) - 50.0; 
+      heap.insert( std::make_pair( p, v ) ); 
+      set.insert( std::make_pair( p, v ) ); 
+    }
+  nbok += heap.isValid() ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << heap << std::endl;
+
+  //the set may contain several pairs for the same point
+  //but the first extracted one is the one of the heap
+  bool flagIsOk = true; 
+  std::set<Point> extracted; 
+  while ( !heap.empty() )
+    {
+      while ( extracted.find( set.top().first ) != extracted.end() ) set.pop(); 
+      if ( set.top() != heap.top() ) flagIsOk = false; 
+      extracted.insert( heap.top().first ); 
+      set.pop(); 
+      heap.pop(); 
+      if ( !heap.isValid() ) flagIsOk = false; 
+    }
+  nbok += flagIsOk ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same extraction order" << std::endl;
+
+  //FMM with both containers
+  typedef BallPredicate<Point> Predicate; 
+  Predicate predicate( 0, 0, size/2 ); 
+  typedef KhalimskySpaceND< dimension, int > KSpace; 
+  KSpace K; K.init( Point::diagonal(-size), Point::diagonal(size), true); 
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, predicate, 10000 );
+  std::vector<KSpace::SCell> vSCells;
+  Surfaces<KSpace>::track2DBoundary( vSCells, K, SAdj, predicate, bel );
+
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set;
+  typedef L2SecondOrderLocalDistance<Image, Set> Distance; 
+  typedef ImageContainerBySTLMap<Domain, unsigned int> SparseSlotImage; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance > FMM1; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance, 
+    FMMCandidateHeap<SparseSlotImage, double> > FMM2; 
+  DomainPredicate<Domain> dp(d);
+  double maxWidth = size/2.0;
+
+  Image map1( d ); 
+  Set set1( map1 ); 
+  FMM1::initFromBelsRange( K, vSCells.begin(), vSCells.end(), map1, set1, 0.5 ); 
+  Distance distance1( map1, set1 ); 
+  FMM1 fmm1( map1, set1, dp, d.size(), maxWidth, distance1 ); 
+
+  Image map2( d ); 
+  Set set2( map2 ); 
+  FMM2::initFromBelsRange( K, vSCells.begin(), vSCells.end(), map2, set2, 0.5 ); 
+  Distance distance2( map2, set2 ); 
+  FMM2 fmm2( map2, set2, dp, d.size(), maxWidth, distance2 ); 
+
+  Point p1, p2; 
+  double v1 = 0, v2 = 0; 
+  bool flag1 = true, flag2 = true; 
+  flagIsOk = true; 
+  unsigned int nbSteps = 0; 
+  while ( flagIsOk && flag1 && flag2 )
+    {
+      flag1 = fmm1.computeOneStep( p1, v1 ); 
+      flag2 = fmm2.computeOneStep( p2, v2 ); 
+      if ( (flag1 != flag2) || ( flag1 && ( (p1 != p2) || (v1 != v2) ) ) )
+	flagIsOk = false; 
+      ++nbSteps; 
+    }
+  trace.info() << fmm1 << std::endl; 
+  trace.info() << fmm2 << std::endl; 
+  nbok += ( flagIsOk && (set1.size() == set2.size()) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same FMM steps (" 
+	       << nbSteps << ")" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb; 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -673,6 +782,7 @@ int main ( int argc, char** argv )
     && testDisplayDT2d( size, 2*area, std::sqrt(2*size*size) )
     && testDisplayDTFromCircle(size)   
     && accuracyTest(size)
+    && testCandidateHeap(size)
     ;
 
   size = 25;
@@ -0,0 +1,183 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/io/writers/VolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the distances of a raw file with the ones of
+ * DistanceTransformation.
+ */
+template <typename Metric>
+bool checkDistances( const Image & image, const Metric & metric,
+                     const std::string & filename )
+{
+  typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef DistanceTransformation<Z3i::Space, Predicate, Metric> DT;
+  Predicate predicate( image, 0 );
+  DT dt( &image.domain(), &predicate, &metric );
+
+  std::ifstream in( filename.c_str(), std::ifstream::in | std::ifstream::binary );
+  std::vector<double> values( image.domain().size() );
+  in.read( reinterpret_cast<char*>( &values[0] ), values.size() * sizeof( double ) );
+  if ( (unsigned int) in.gcount() != values.size() * sizeof( double ) )
+    return false;
+
+  unsigned int i = 0;
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it, ++i )
+    if ( dt( *it ) != values[ i ] )
+      {
+        trace.error() << "Distance at " << *it << ": " << values[ i ]
+                      << " instead of " << dt( *it ) << std::endl;
+        return false;
+      }
+  return true;
+}
+
+/**
+ * Distance transformations with small memory budgets.
+ */
+bool testOutOfCoreDT()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing out-of-core distance transformation ..." );
+
+  //A volume with a few sites (value 0)
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 22, 18, 16 ) );
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Z3i::Point p = *it;
+      bool isSite = ( ( p - Z3i::Point( 7, 9, 4 ) ).norm() < 3 )
+        || ( ( p[0] * 7 + p[1] * 13 + p[2] * 5 ) % 89 == 0 );
+      image.setValue( p, isSite ? 0 : 255 );
+    }
+  RawWriter<Image>::exportRaw8( "testOutOfCoreDT.raw", image );
+  VolWriter<Image>::exportVol( "testOutOfCoreDT.vol", image );
+
+  Z3i::L2Metric l2;
+  Z3i::L1Metric l1;
+  Z3i::Vector extent = domain.upperBound() - domain.lowerBound() + Z3i::Vector::diagonal( 1 );
+  //budgets: whole volume, several slices and blocks, one slice and one column
+  unsigned int budgets[ 3 ] = { 64*1024*1024, 20000, 1 };
+  for ( unsigned int b = 0; b < 3; ++b )
+    {
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::L2Metric, double> dt( l2, budgets[ b ] );
+      dt.computeFromRaw( "testOutOfCoreDT.raw", extent, "testOutOfCoreDT-l2.raw" );
+      trace.info() << dt << std::endl;
+      nbok += checkDistances( image, l2, "testOutOfCoreDT-l2.raw" ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") raw, L2" << std::endl;
+
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::L1Metric, double> dt1( l1, budgets[ b ] );
+      Z3i::Vector volExtent = dt1.computeFromVol( "testOutOfCoreDT.vol", "testOutOfCoreDT-l1.raw" );
+      trace.info() << dt1 << std::endl;
+      nbok += ( volExtent == extent && checkDistances( image, l1, "testOutOfCoreDT-l1.raw" ) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") vol, L1" << std::endl;
+    }
+
+  //Missing input
+  bool thrown = false;
+  try
+    {
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::L2Metric, double> dt( l2 );
+      dt.computeFromRaw( "testOutOfCoreDT-noFile.raw", extent, "testOutOfCoreDT-l2.raw" );
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") missing file" << std::endl;
+
+  //Truncated input: the temporary sites file is removed
+  thrown = false;
+  try
+    {
+      OutOfCoreDistanceTransformation<Z3i::Space, Z3i::L2Metric, double> dt( l2 );
+      dt.computeFromRaw( "testOutOfCoreDT.raw", extent + Z3i::Vector( 0, 0, 1 ),
+                         "testOutOfCoreDT-l2.raw" );
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  std::ifstream sites( "testOutOfCoreDT-l2.raw.sites" );
+  nbok += ( thrown && ! sites.good() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") truncated file" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOutOfCoreDT();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
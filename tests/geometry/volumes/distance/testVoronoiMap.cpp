@@ -548,6 +548,74 @@ bool testSimple4D()
 }
 
 
+/**
+ * Metric with the same predicates as its base class, for which the
+ * generic SeparableMetricRowKernel is selected.
+ */
+template <typename Metric>
+struct GenericKernelMetric: public Metric
+{
+};
+
+/**
+ * Compares the Voronoi maps computed with the specialized and the
+ * generic row kernels.
+ */
+template <typename Metric>
+bool checkRowKernel(const Z3i::DigitalSet &aSet, const Metric &aMetric)
+{
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, Metric> Voro;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, GenericKernelMetric<Metric> > VoroGeneric;
+  Z3i::DigitalSet complement( aSet.domain() );
+  complement.assignFromComplement( aSet );
+  GenericKernelMetric<Metric> metric;
+
+  Voro voro( aSet.domain(), complement, aMetric );
+  VoroGeneric voroGeneric( aSet.domain(), complement, metric );
+
+  for(Z3i::Domain::ConstIterator it = aSet.domain().begin(), itend = aSet.domain().end();
+      it != itend; ++it)
+    if ( voro(*it) != voroGeneric(*it) )
+      {
+        trace.error() << aMetric << " at "<< *it << ": " << voro(*it)
+                      << " instead of " << voroGeneric(*it) << std::endl;
+        return false;
+      }
+  return true;
+}
+
+bool testRowKernels()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Z3i::Point a(0,0,0);
+  Z3i::Point b(31,23,27);
+  Z3i::Domain domain(a,b);
+  Z3i::DigitalSet sites(domain);
+
+  trace.beginBlock("Row kernels");
+  for(unsigned int i = 0 ; i < 48; ++i)
+    sites.insert( Z3i::Point( rand() % (b[0]+1), rand() % (b[1]+1), rand() % (b[2]+1) ) );
+  //Aligned sites (equidistant points)
+  sites.insert( Z3i::Point( 4, 4, 4 ) );
+  sites.insert( Z3i::Point( 4, 10, 4 ) );
+  sites.insert( Z3i::Point( 4, 4, 10 ) );
+
+  nbok += checkRowKernel( sites, ExactPredicateLpSeparableMetric<Z3i::Space,1>() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L1" << std::endl;
+  nbok += checkRowKernel( sites, ExactPredicateLpSeparableMetric<Z3i::Space,2>() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L2" << std::endl;
+  nbok += checkRowKernel( sites, ExactPredicateLpSeparableMetric<Z3i::Space,3>() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L3" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -566,6 +634,7 @@ int main( int argc, char** argv )
     && testSimple3D() 
     && testSimpleRandom3D()
     && testSimple4D()
+    && testRowKernels()
     ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
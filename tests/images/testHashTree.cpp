@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/io/boards/Board2D.h"
@@ -41,6 +43,7 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 
 #include "DGtal/helpers/StdDefs.h"
 
@@ -108,9 +111,21 @@ bool testHashTree2D()
 
   Image myImage(domain);
   trace.info()<< myImage<<std::endl;
+
+  //Batch computation of the keys
+  std::vector<Z2i::Point> points;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    points.push_back( *it );
+  std::vector<Image::HashKey> keys( points.size() );
+  myImage.getKeys( points.begin(), points.end(), keys.begin() );
+  bool ok = true;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    ok = ok && ( keys[ i ] == myImage.getKey( points[ i ] ) );
+  trace.info() << "getKeys == getKey: " << ok << std::endl;
   trace.endBlock();
 
-  return true;
+  return ok;
 }
 
 /**
@@ -282,6 +297,196 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Compares the values of a hash tree to the values of an image.
+ */
+template <typename Tree, typename Image>
+bool sameValues( const Tree & tree, const Image & image )
+{
+  for ( typename Image::Domain::ConstIterator it = image.domain().begin(),
+          itEnd = image.domain().end(); it != itEnd; ++it )
+    if ( tree( *it ) != image( *it ) )
+      return false;
+  return true;
+}
+
+/**
+ * Counts the nodes of a hash tree by iteration.
+ */
+template <typename Tree>
+unsigned int nbIteratedNodes( Tree & tree )
+{
+  unsigned int count = 0;
+  for ( typename Tree::Iterator it = tree.begin(), itEnd = tree.end();
+        it != itEnd; ++it )
+    ++count;
+  return count;
+}
+
+/**
+ * Chained and Robin Hood storages, with setValue and with the bulk
+ * construction.
+ */
+bool testStorages()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z2i::Domain TDomain;
+  typedef TDomain::Point Point;
+  typedef experimental::ImageContainerByHashTree<TDomain, int> Chained;
+  typedef experimental::ImageContainerByHashTree
+    < TDomain, int, DGtal::uint64_t,
+      experimental::RobinHoodHashTreeStorage<DGtal::uint64_t, int> > RobinHood;
+  typedef ImageContainerBySTLVector<TDomain, int> ImageVector;
+
+  trace.beginBlock ( "Testing the storages ..." );
+  srand( 0 );
+  TDomain domain( Point( 0, 0 ), Point( 255, 255 ) );
+  ImageVector reference( domain );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      const Point & a = *it;
+      const double v = pow( (double)( a[0]-128 ), 3.0 ) - pow( (double)( a[1]-128 ), 3.0 );
+      int value = ( v < pow( 32.0, 3.0 ) ) ? 30 : ( ( v < pow( 64.0, 3.0 ) ) ? 10 : 0 );
+      if ( ( a[0] >= 200 ) && ( a[1] < 40 ) )
+        value = rand() % 3;
+      reference.setValue( a, value );
+    }
+
+  Chained chained( 3, 8, 0 );
+  RobinHood robinHood( 3, 8, 0 );
+  trace.beginBlock ( "setValue (chained lists)" );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    chained.setValue( *it, reference( *it ) );
+  trace.endBlock();
+  trace.beginBlock ( "setValue (Robin Hood)" );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    robinHood.setValue( *it, reference( *it ) );
+  trace.endBlock();
+  trace.info() << chained;
+  trace.info() << robinHood;
+  nbok += ( sameValues( chained, reference ) && sameValues( robinHood, reference )
+            && ( chained.getNbNodes() == robinHood.getNbNodes() )
+            && ( nbIteratedNodes( robinHood ) == robinHood.getNbNodes() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "setValue: same values, " << robinHood.getNbNodes() << " nodes" << std::endl;
+
+  Chained chainedBulk( 3, 8, 0 );
+  RobinHood robinHoodBulk( 3, 8, 0 );
+  trace.beginBlock ( "fromImage (chained lists)" );
+  chainedBulk.fromImage( reference );
+  trace.endBlock();
+  trace.beginBlock ( "fromImage (Robin Hood)" );
+  robinHoodBulk.fromImage( reference );
+  trace.endBlock();
+  trace.info() << robinHoodBulk;
+  nbok += ( sameValues( chainedBulk, reference ) && sameValues( robinHoodBulk, reference )
+            && ( chainedBulk.getNbNodes() == robinHoodBulk.getNbNodes() )
+            && ( robinHoodBulk.getNbNodes() <= robinHood.getNbNodes() )
+            && ( nbIteratedNodes( chainedBulk ) == chainedBulk.getNbNodes() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fromImage: same values, " << robinHoodBulk.getNbNodes() << " nodes" << std::endl;
+
+  //Partial image, the other points taking the default value
+  TDomain subDomain( Point( 10, 20 ), Point( 100, 30 ) );
+  ImageVector partial( subDomain );
+  for ( TDomain::ConstIterator it = subDomain.begin(), itEnd = subDomain.end();
+        it != itEnd; ++it )
+    partial.setValue( *it, 1 + rand() % 2 );
+  robinHoodBulk.fromImage( partial, 7 );
+  bool ok = sameValues( robinHoodBulk, partial );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( ! subDomain.isInside( *it ) )
+      ok = ok && ( robinHoodBulk( *it ) == 7 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fromImage of a part of the domain" << std::endl;
+
+  //Uniform image: only the root
+  ImageVector uniform( domain );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    uniform.setValue( *it, 4 );
+  chainedBulk.fromImage( uniform );
+  nbok += ( chainedBulk.getNbNodes() == 1 ) && ( chainedBulk( Point( 3, 5 ) ) == 4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "uniform image: one node" << std::endl;
+
+  //Small tree, checked by checkIntegrity
+  RobinHood small( 2, 3, 0 );
+  TDomain smallDomain( Point( 0, 0 ), Point( 7, 7 ) );
+  ImageVector smallImage( smallDomain );
+  for ( TDomain::ConstIterator it = smallDomain.begin(), itEnd = smallDomain.end();
+        it != itEnd; ++it )
+    smallImage.setValue( *it, ( (*it)[0] < 4 ) ? 1 : rand() % 2 );
+  small.fromImage( smallImage );
+  nbok += ( small.checkIntegrity() && sameValues( small, smallImage ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "integrity of a small tree" << std::endl;
+
+  //Sparse 3D volume: iteration and memory, compared to the STL map
+  typedef experimental::ImageContainerByHashTree
+    < Z3i::Domain, int, DGtal::uint64_t,
+      experimental::RobinHoodHashTreeStorage<DGtal::uint64_t, int> > SparseVolume;
+  typedef ImageContainerBySTLMap<Z3i::Domain, int> MapVolume;
+  Z3i::Domain domain3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 63, 63, 63 ) );
+  ImageContainerBySTLVector<Z3i::Domain, int> ball( domain3 );
+  MapVolume map( domain3 );
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(), itEnd = domain3.end();
+        it != itEnd; ++it )
+    {
+      const int value = ( ( *it - Z3i::Point( 30, 32, 35 ) ).norm() < 20 ) ? 1 + (*it)[ 2 ] / 8 : 0;
+      ball.setValue( *it, value );
+      if ( value != 0 )
+        map.setValue( *it, value );
+    }
+  SparseVolume volume( 3, 6, 0 );
+  volume.fromImage( ball );
+  experimental::ImageContainerByHashTree<Z3i::Domain, int, DGtal::uint64_t> chainedVolume( 3, 6, 0 );
+  chainedVolume.fromImage( ball );
+  const std::size_t mapMemory = map.size() * ( sizeof( Z3i::Point ) + sizeof( int ) );
+  trace.info() << volume;
+  trace.info() << map.size() << " values in the map (" << mapMemory << " bytes at least), "
+               << volume.getNbNodes() << " nodes in the tree ("
+               << volume.getMemory() << " bytes, " << chainedVolume.getMemory()
+               << " bytes with the chained storage)" << std::endl;
+  //the uniform regions are merged: fewer nodes and less memory than the map
+  nbok += ( volume.getNbNodes() < map.size() ) && ( volume.getMemory() < mapMemory )
+    && ( chainedVolume.getMemory() < mapMemory ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sparse volume: fewer nodes and less memory than the map" << std::endl;
+  //each node of the tree is visited once, each value of the map once
+  unsigned int nbVisited = 0;
+  trace.beginBlock ( "Iteration (Robin Hood)" );
+  for ( SparseVolume::Iterator it = volume.begin(), itEnd = volume.end(); it != itEnd; ++it )
+    ++nbVisited;
+  trace.endBlock();
+  unsigned int nbMapVisited = 0;
+  trace.beginBlock ( "Iteration (STL map)" );
+  for ( MapVolume::ConstIterator it = map.begin(), itEnd = map.end(); it != itEnd; ++it )
+    ++nbMapVisited;
+  trace.endBlock();
+  nbok += ( sameValues( volume, ball ) && ( nbVisited == volume.getNbNodes() )
+            && ( nbVisited < nbMapVisited ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sparse volume: " << volume.getNbNodes() << " nodes" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -293,7 +498,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testStorages();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
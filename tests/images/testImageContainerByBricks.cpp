@@ -0,0 +1,284 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Concept checking.
+ */
+bool testConcepts()
+{
+  BOOST_CONCEPT_ASSERT(( CImage< ImageContainerByBricks<Z3i::Domain, int> > ));
+  BOOST_CONCEPT_ASSERT(( CImage< ImageContainerByBricks<Z2i::Domain, Z2i::Vector, 4> > ));
+  BOOST_STATIC_ASSERT(( boost::is_same< ImageSelector<Z3i::Domain, int, SPARSE_I>::Type,
+                        ImageContainerByBricks<Z3i::Domain, int> >::value ));
+  return true;
+}
+
+/**
+ * Random writes in a 3D image whose sizes are not multiples of the
+ * brick size, compared with ImageContainerBySTLVector.
+ */
+bool testGetSetValues()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing random writes ..." );
+  typedef ImageContainerByBricks<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Reference;
+  Z3i::Domain domain( Z3i::Point( -5, 2, -11 ), Z3i::Point( 29, 17, 3 ) );
+  Image image( domain, 7 );
+  Reference reference( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    reference.setValue( *it, 7 );
+
+  nbok += ( image.nbBricks() == 5 * 2 * 2 ) ? 1 : 0;
+  nb++;
+  nbok += ( image.nbAllocatedBricks() == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << image << std::endl;
+
+  srand( 0 );
+  for ( unsigned int i = 0; i < 300; ++i )
+    {
+      const Z3i::Point p( -5 + rand() % 35, 2 + rand() % 16, -11 + rand() % 15 );
+      const int value = rand() % 4 + 6;
+      image.setValue( p, value );
+      reference.setValue( p, value );
+    }
+  image.setValue( domain.upperBound(), 1 );
+  reference.setValue( domain.upperBound(), 1 );
+
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    same = same && ( image( *it ) == reference( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  nbok += ( image.nbAllocatedBricks() > 0 ) && ( image.nbAllocatedBricks() <= image.nbBricks() )
+    && image.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << image << std::endl;
+
+  //Copy
+  Image copy( image );
+  Image other( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1, 1, 1 ) ) );
+  other = image;
+  bool sameCopies = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    sameCopies = sameCopies && ( copy( *it ) == reference( *it ) )
+      && ( other( *it ) == reference( *it ) );
+  nbok += sameCopies ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") copies" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Brick iterator and folding of the uniform bricks.
+ */
+bool testBrickIterator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing the brick iterator and the folding ..." );
+  typedef ImageContainerByBricks<Z3i::Domain, int, 2> Image;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 6, 4 ) );
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( (*it)[ 0 ] + (*it)[ 1 ] > 8 )
+      image.setValue( *it, (*it)[ 0 ] + 100 * (*it)[ 2 ] );
+
+  //Each point is visited once, with its value
+  Z3i::DigitalSet visited( domain );
+  bool sameValues = true;
+  unsigned int nbPoints = 0;
+  for ( Image::ConstIterator it = image.begin(), itEnd = image.end(); it != itEnd; ++it )
+    {
+      visited.insert( it.point() );
+      sameValues = sameValues && ( *it == image( it.point() ) );
+      ++nbPoints;
+    }
+  nbok += ( nbPoints == domain.size() ) && ( visited.size() == domain.size() ) ? 1 : 0;
+  nb++;
+  nbok += sameValues ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbPoints << " points" << std::endl;
+
+  //Skipping the uniform bricks
+  unsigned int nbNonZero = 0;
+  for ( Image::ConstIterator it = image.begin(), itEnd = image.end(); it != itEnd; )
+    if ( it.isUniform() && ( *it == 0 ) )
+      it.nextBrick();
+    else
+      {
+        nbNonZero += ( *it != 0 ) ? 1 : 0;
+        ++it;
+      }
+  unsigned int nbExpected = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    nbExpected += ( image( *it ) != 0 ) ? 1 : 0;
+  nbok += ( nbNonZero == nbExpected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbNonZero << " non zero values" << std::endl;
+
+  //Uniform overwrite then folding
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    image.setValue( *it, ( (*it)[ 0 ] < 4 ) ? 5 : 3 );
+  const std::size_t nbFolded = image.fold();
+  nbok += ( nbFolded == image.nbBricks() ) && ( image.nbAllocatedBricks() == 0 ) ? 1 : 0;
+  nb++;
+  bool sameFolded = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    sameFolded = sameFolded && ( image( *it ) == ( ( (*it)[ 0 ] < 4 ) ? 5 : 3 ) );
+  nbok += sameFolded ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbFolded << " folded bricks, "
+               << image << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Use with the tools working on images.
+ */
+bool testImageTools()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing imageFromImage and SetFromImage ..." );
+  typedef ImageContainerByBricks<Z3i::Domain, unsigned char> Image;
+  Z3i::Domain domain( Z3i::Point( -10, -10, -10 ), Z3i::Point( 20, 12, 10 ) );
+  Image image( domain );
+  unsigned int nbInside = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( (*it).dot( *it ) < 50 )
+      {
+        image.setValue( *it, (*it).dot( *it ) < 20 ? 200 : 100 );
+        nbInside += ( (*it).dot( *it ) < 20 ) ? 1 : 0;
+      }
+
+  Image copy( domain );
+  imageFromImage( copy, image );
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    same = same && ( copy( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << copy << std::endl;
+
+  Z3i::DigitalSet set( domain );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( set, image, 150, 255 );
+  nbok += ( set.size() == nbInside ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << set.size() << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing VoronoiMap ..." );
+  Z2i::Domain domain2( Z2i::Point( -20, -15 ), Z2i::Point( 25, 17 ) );
+  Z2i::DigitalSet notSites( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(), itEnd = domain2.end();
+        it != itEnd; ++it )
+    notSites.insertNew( *it );
+  notSites.erase( Z2i::Point( 0, -6 ) );
+  notSites.erase( Z2i::Point( 6, 0 ) );
+  notSites.erase( Z2i::Point( -13, 11 ) );
+
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z2i::Space, Z2i::DigitalSet, L2Metric> Voro;
+  typedef VoronoiMap<Z2i::Space, Z2i::DigitalSet, L2Metric,
+                     ImageContainerByBricks<Z2i::Domain, Z2i::Vector> > VoroBricks;
+  L2Metric l2;
+  Voro voro( &domain2, &notSites, &l2 );
+  VoroBricks voroBricks( &domain2, &notSites, &l2 );
+  bool sameSites = true;
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(), itEnd = domain2.end();
+        it != itEnd; ++it )
+    sameSites = sameSites && ( voro( *it ) == voroBricks( *it ) );
+  nbok += sameSites ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByBricks" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testConcepts() && testGetSetValues() && testBrickIterator()
+    && testImageTools(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,10 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
 
 using namespace DGtal;
 using namespace std;
@@ -120,11 +124,95 @@ bool testSpanIterators()
 }
 
 
+bool testRowTraversal()
+{
+    typedef SpaceND<3> Space3Type;
+    typedef Space3Type::Point Point;
+    typedef HyperRectDomain<Space3Type> TDomain;
+    typedef ImageContainerBySTLVector<TDomain, int> TContainerV;
+    typedef DigitalSetBySTLSet<TDomain> TSet;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Test of row traversal");
+    TDomain domain( Point( -2, 1, 3 ), Point( 4, 3, 7 ) );
+    TContainerV myImageV ( domain );
+    int cpt = 0;
+    for ( TDomain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      myImageV.setValue( *it, ( cpt++ * 7 ) % 11 );
+
+    nbok += ( myImageV.rowLength() == 7 ) ? 1 : 0;
+    nbok += ( myImageV.nbRows() == 3 * 5 ) ? 1 : 0;
+    nb += 2;
+
+    //Rows follow the domain order and match the span iterators
+    TDomain::ConstIterator itDom = domain.begin();
+    bool sameValues = true;
+    for ( TContainerV::Size row = 0; row < myImageV.nbRows(); ++row )
+      {
+        Point p = myImageV.rowPoint( row );
+        sameValues = sameValues && ( p == *itDom );
+        TContainerV::SpanIterator itSpan = myImageV.spanBegin( p, 0 );
+        for ( const int *it = myImageV.rowBegin( row ); it != myImageV.rowEnd( row );
+              ++it, ++itSpan, ++itDom )
+          sameValues = sameValues && ( *it == *itSpan )
+            && ( *it == myImageV( *itDom ) );
+      }
+    sameValues = sameValues && ( itDom == domain.end() );
+    nbok += sameValues ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "rows == domain scan" << std::endl;
+
+    //Row-based helpers give the same sets as the domain scans
+    TSet setRows( domain ), setDomain( domain );
+    SetFromImage<TSet>::append<TContainerV>( setRows, myImageV, 2, 7 );
+    IntervalForegroundPredicate<TContainerV> isForeground( myImageV, 2, 7 );
+    SetFromImage<TSet>::append<TContainerV>( setDomain, isForeground,
+                                             domain.begin(), domain.end() );
+    nbok += ( setRows.size() == setDomain.size()
+              && std::equal( setRows.begin(), setRows.end(), setDomain.begin() ) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "SetFromImage::append " << setRows.size() << std::endl;
+
+    TSet setThreshold( domain ), setThresholdDomain( domain );
+    setFromImage( myImageV, DigitalSetInserter<TSet>( setThreshold ), 4 );
+    details::setFromImage( myImageV, DigitalSetInserter<TSet>( setThresholdDomain ), 4,
+                           boost::false_type() );
+    nbok += ( setThreshold.size() == setThresholdDomain.size()
+              && std::equal( setThreshold.begin(), setThreshold.end(),
+                             setThresholdDomain.begin() ) ) ? 1 : 0;
+    nb++;
+    TSet setInterval( domain ), setIntervalDomain( domain );
+    setFromImage( myImageV, DigitalSetInserter<TSet>( setInterval ), 3, 8 );
+    details::setFromImage( myImageV, DigitalSetInserter<TSet>( setIntervalDomain ), 3, 8,
+                           boost::false_type() );
+    nbok += ( setInterval.size() == setIntervalDomain.size()
+              && std::equal( setInterval.begin(), setInterval.end(),
+                             setIntervalDomain.begin() ) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "setFromImage " << setThreshold.size()
+                 << " " << setInterval.size() << std::endl;
+
+    TContainerV myCopy( domain );
+    imageFromImage( myCopy, myImageV );
+    nbok += std::equal( myCopy.begin(), myCopy.end(), myImageV.begin() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "imageFromImage" << std::endl;
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 
 int main()
 {
 
-    if ( testSpanIterators())
+    if ( testSpanIterators() && testRowTraversal() )
         return 0;
     else
         return 1;
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,88 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Compares the codes to a bit by bit interleaving, with and without
+ * the PDEP/PEXT instructions, on random points.
+ */
+template <typename HashKey, Dimension dim>
+bool testFastMorton()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<dim, DGtal::int32_t> Point;
+  typedef Morton<HashKey, Point> MortonCode;
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / dim;
+  const unsigned int treeDepth = coordSize - 1;
+  const DGtal::uint32_t maxCoordinate = ( 1u << treeDepth ) - 1;
+
+  trace.beginBlock ( "Testing fast Morton codes ..." );
+  trace.info() << dim << "D, " << sizeof( HashKey ) * 8 << " bits, "
+               << ( MortonCode::Dilation::isFast ? "magic numbers" : "generic" )
+               << std::endl;
+
+  std::vector<Point> points;
+  for ( unsigned int k = 0; k < 10000; ++k )
+    {
+      Point p;
+      for ( Dimension n = 0; n < dim; ++n )
+        p[ n ] = static_cast<DGtal::int32_t>( ( ( rand() << 16 ) ^ rand() ) & maxCoordinate );
+      points.push_back( p );
+    }
+
+  MortonCode morton;
+  for ( unsigned int bmi2 = 0; bmi2 < 2; ++bmi2 )
+    {
+      const bool used = morton.useBMI2( bmi2 == 1 );
+      if ( ( bmi2 == 1 ) && ! used )
+        {
+          trace.info() << "PDEP/PEXT not available" << std::endl;
+          break;
+        }
+      bool ok = true;
+      for ( unsigned int k = 0; k < points.size(); ++k )
+        {
+          //reference
+          HashKey ref = 0;
+          for ( unsigned int i = 0; i < coordSize; ++i )
+            for ( Dimension n = 0; n < dim; ++n )
+              if ( static_cast<DGtal::uint32_t>( points[ k ][ n ] ) & ( 1u << i ) )
+                ref |= static_cast<HashKey>( 1 ) << ( i * dim + n );
+          HashKey h;
+          morton.interleaveBits( points[ k ], h );
+          Point q;
+          morton.coordinatesFromKey( morton.keyFromCoordinates( treeDepth, points[ k ] ), q );
+          ok = ok && ( h == ref ) && ( q == points[ k ] );
+        }
+
+      std::vector<HashKey> keys( points.size() );
+      morton.keysFromCoordinates( treeDepth, points.begin(), points.end(), keys.begin() );
+      for ( unsigned int k = 0; k < points.size(); ++k )
+        ok = ok && ( keys[ k ] == morton.keyFromCoordinates( treeDepth, points[ k ] ) );
+
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << ( used ? "PDEP/PEXT" : "shifts and masks" ) << std::endl;
+    }
+
+  //boundaries: all the bits of the coordinates, and the depth bit
+  Point full = Point::diagonal( static_cast<DGtal::int32_t>( maxCoordinate ) );
+  Point q;
+  HashKey h = morton.keyFromCoordinates( treeDepth, full );
+  morton.coordinatesFromKey( h, q );
+  nbok += ( h == static_cast<HashKey>( ~static_cast<HashKey>( 0 )
+                                       >> ( sizeof( HashKey ) * 8 - treeDepth * dim - 1 ) ) )
+    && ( q == full ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "all the bits: " << Bits::bitString( h ) << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +215,12 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton()
+    && testFastMorton<DGtal::uint32_t, 2>()
+    && testFastMorton<DGtal::uint64_t, 2>()
+    && testFastMorton<DGtal::uint32_t, 3>()
+    && testFastMorton<DGtal::uint64_t, 3>()
+    && testFastMorton<DGtal::uint64_t, 4>(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
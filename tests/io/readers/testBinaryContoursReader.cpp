@@ -0,0 +1,230 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBinaryContoursReader.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes BinaryContoursWriter and BinaryContoursReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/io/writers/BinaryContoursWriter.h"
+#include "DGtal/io/readers/BinaryContoursReader.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes BinaryContoursWriter and BinaryContoursReader.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Writes and reads back point contours, including an empty one.
+ */
+bool testPointContours()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing binary point contours ..." );
+  std::vector< std::vector<Z2i::Point> > contours;
+  contours.push_back( PointListReader<Z2i::Point>::getPointsFromFile
+                      ( testPath + "samples/france.sdp" ) );
+  contours.push_back( std::vector<Z2i::Point>() );
+  std::vector<Z2i::Point> c;
+  for ( int i = 0; i < 7; ++i )
+    c.push_back( Z2i::Point( -i, 3 * i - 100000 ) );
+  contours.push_back( c );
+  BinaryContoursWriter::exportPointContours( "testBinaryContours.bin", contours );
+
+  BinaryContoursReader<Z2i::Point> reader( "testBinaryContours.bin" );
+  trace.info() << reader << std::endl;
+  nbok += ( reader.kind() == BinaryContoursFormat::POINTS
+            && reader.size() == contours.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") kind and size" << std::endl;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      BinaryContoursReader<Z2i::Point>::PointRange r = reader.points( i );
+      std::vector<Z2i::Point> inPlace( r.begin(), r.end() );
+      std::vector<Z2i::Point> copied;
+      reader.getPoints( i, copied );
+      nbok += ( inPlace == contours[ i ] && copied == contours[ i ]
+                && reader.nbElements( i ) == contours[ i ].size()
+                && (unsigned int) ( r.end() - r.begin() ) == contours[ i ].size() )
+        ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") contour " << i
+                   << " with " << contours[ i ].size() << " points" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Writes and reads back Freeman chains.
+ */
+bool testFreemanChains()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing binary Freeman chains ..." );
+  typedef FreemanChain<int> FC;
+  std::vector<FC> chains = PointListReader<Z2i::Point>::getFreemanChainsFromFile<int>
+    ( testPath + "samples/freemanChainSample.fc" );
+  chains.push_back( FC( "", 3, -4 ) );
+  chains.push_back( FC( "01230", 1, 2 ) );
+  BinaryContoursWriter writer;
+  writer.open( "testBinaryContours.bin", BinaryContoursFormat::FREEMAN_CHAINS );
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    writer.addFreemanChain( chains[ i ] );
+  nbok += ( writer.nbContours() == chains.size() ) ? 1 : 0;
+  nb++;
+  nbok += writer.close() ? 1 : 0;
+  nb++;
+
+  BinaryContoursReader<Z2i::Point> reader;
+  reader.open( "testBinaryContours.bin" );
+  trace.info() << reader << std::endl;
+  nbok += ( reader.kind() == BinaryContoursFormat::FREEMAN_CHAINS
+            && reader.size() == chains.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") kind and size" << std::endl;
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      FC fc;
+      reader.getFreemanChain( i, fc );
+      BinaryContoursReader<Z2i::Point>::CodeRange r = reader.codes( i );
+      std::vector<Z2i::Point> points, expPoints;
+      reader.getPoints( i, points );
+      FC::getContourPoints( chains[ i ], expPoints );
+      nbok += ( fc == chains[ i ]
+                && std::string( r.begin(), r.end() ) == chains[ i ].chain
+                && points == expPoints ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") chain " << i
+                   << " with " << chains[ i ].chain.size() << " codes" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Writes and reads back Freeman chains with more codes than the
+ * file has bytes.
+ */
+bool testLongFreemanChains()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing long binary Freeman chains ..." );
+  typedef FreemanChain<int> FC;
+  const char* files[ 2 ] = { "samples/klokan.fc", "samples/france.fc" };
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      std::vector<FC> chains = PointListReader<Z2i::Point>::getFreemanChainsFromFile<int>
+        ( testPath + files[ i ] );
+      BinaryContoursWriter::exportFreemanChains( "testBinaryContours.bin", chains );
+      BinaryContoursReader<Z2i::Point> reader;
+      bool ok = true;
+      try
+        {
+          reader.open( "testBinaryContours.bin" );
+        }
+      catch ( DGtal::IOException & )
+        {
+          ok = false;
+        }
+      ok = ok && ( reader.size() == chains.size() );
+      for ( unsigned int j = 0; ok && ( j < chains.size() ); ++j )
+        {
+          FC fc;
+          reader.getFreemanChain( j, fc );
+          ok = ( fc == chains[ j ] );
+        }
+      nbok += ( ok && ! chains.empty() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << files[ i ] << " with "
+                   << ( chains.empty() ? 0 : chains[ 0 ].chain.size() ) << " codes" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that other files are rejected.
+ */
+bool testInvalidFile()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing invalid files ..." );
+  const char* files[ 2 ] = { "samples/france.sdp", "samples/noFile.bin" };
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      BinaryContoursReader<Z2i::Point> reader;
+      bool thrown = false;
+      try
+        {
+          reader.open( testPath + files[ i ] );
+        }
+      catch ( DGtal::IOException & )
+        {
+          thrown = true;
+        }
+      nbok += ( thrown && ! reader.isOpen() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << files[ i ] << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing classes BinaryContoursWriter and BinaryContoursReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPointContours() && testFreemanChains() && testLongFreemanChains()
+    && testInvalidFile();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,253 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBrickedVolume.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes BrickedVolumeWriter and
+ * BrickedVolumeReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/BrickedVolumeReader.h"
+#include "DGtal/io/writers/BrickedVolumeWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes BrickedVolumeWriter and BrickedVolumeReader.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+
+bool roundTrip( const std::vector<unsigned char> & values,
+                BrickedVolumeFormat::Codec expected )
+{
+  std::vector<char> code;
+  BrickedVolumeFormat::Codec codec =
+    BrickedVolumeFormat::encodeBrick( reinterpret_cast<const char*>( &values[ 0 ] ),
+                                      values.size(), 1, code );
+  std::vector<unsigned char> decoded( values.size() );
+  bool ok = BrickedVolumeFormat::decodeBrick( codec, &code[ 0 ], code.size(),
+                                              reinterpret_cast<char*>( &decoded[ 0 ] ),
+                                              decoded.size(), 1 );
+  trace.info() << values.size() << " bytes -> " << code.size()
+               << " bytes (codec " << codec << ")" << std::endl;
+  return ok && ( codec == expected ) && ( decoded == values );
+}
+
+bool testCodecs()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing codecs ..." );
+  srand( 0 );
+  std::vector<unsigned char> values( 4096 );
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    values[ i ] = (unsigned char) rand();
+  nbok += roundTrip( values, BrickedVolumeFormat::RAW ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "random values are stored raw" << std::endl;
+
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    values[ i ] = (unsigned char) ( ( i / 700 ) * 40 + ( i % 3 == 0 ? 1 : 0 ) );
+  nbok += roundTrip( values, BrickedVolumeFormat::LZ ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "runs are compressed" << std::endl;
+
+  std::fill( values.begin(), values.end(), 17 );
+  nbok += roundTrip( values, BrickedVolumeFormat::UNIFORM ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "uniform brick" << std::endl;
+
+  // corrupted codes are detected
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    values[ i ] = (unsigned char) ( i % 5 );
+  std::vector<char> code;
+  BrickedVolumeFormat::compress( reinterpret_cast<const char*>( &values[ 0 ] ),
+                                 values.size(), code );
+  std::vector<char> decoded( values.size() );
+  nbok += ( ! BrickedVolumeFormat::decompress( &code[ 0 ], code.size() / 2,
+                                               &decoded[ 0 ], decoded.size() )
+            && ! BrickedVolumeFormat::decompress( &code[ 0 ], code.size(),
+                                                  &decoded[ 0 ], decoded.size() - 1 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated codes are rejected" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testBrickedVolume()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bricked volumes ..." );
+
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  // bricks of side 8 and 16: the latter are clipped on the upper faces of the 40^3 volume.
+  nbok += BrickedVolumeWriter<unsigned char>::exportBrickedVolume( "testBrickedVolume.bvol", image, 3 ) ? 1 : 0;
+  nb++;
+  nbok += BrickedVolumeWriter<unsigned char>::exportBrickedVolume( "testBrickedVolume16.bvol", image, 4 ) ? 1 : 0;
+  nb++;
+
+  BrickedVolumeReader<Image> reader( "testBrickedVolume.bvol" );
+  trace.info() << reader << std::endl;
+  nbok += ( reader.domain().lowerBound() == image.domain().lowerBound()
+            && reader.domain().upperBound() == image.domain().upperBound()
+            && reader.nbBricks() == 125 ) ? 1 : 0;
+  nb++;
+  Image whole = reader.importVolume();
+  nbok += std::equal( image.begin(), image.end(), whole.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "importVolume == importVol" << std::endl;
+
+  Image whole16 = BrickedVolumeReader<Image>::importBrickedVolume( "testBrickedVolume16.bvol" );
+  nbok += std::equal( image.begin(), image.end(), whole16.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "partial edge bricks" << std::endl;
+
+  std::ifstream vol( filename.c_str(), std::ifstream::binary | std::ifstream::ate );
+  std::ifstream bvol( "testBrickedVolume16.bvol", std::ifstream::binary | std::ifstream::ate );
+  trace.info() << "vol: " << vol.tellg() << " bytes, bvol: " << bvol.tellg() << " bytes" << std::endl;
+  nbok += ( bvol.tellg() < vol.tellg() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "compressed file is smaller" << std::endl;
+
+  Z3i::Domain roi( Z3i::Point( 5, 12, 9 ), Z3i::Point( 30, 17, 33 ) );
+  Image sub = BrickedVolumeReader<Image>::importBrickedVolume( "testBrickedVolume.bvol", roi );
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = roi.begin(); it != roi.end(); ++it )
+    same = same && ( sub( *it ) == image( *it ) );
+  nbok += ( same && sub.domain().upperBound() == roi.upperBound() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "importSubDomain" << std::endl;
+
+  // values of another type and streamed slices
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> LImage;
+  Z3i::Domain domain( Z3i::Point::zero, Z3i::Point( 20, 6, 9 ) );
+  LImage limage( domain );
+  DGtal::uint32_t v = 0;
+  for ( LImage::Iterator it = limage.begin(); it != limage.end(); ++it, ++v )
+    *it = ( v / 50 ) * 100000;
+  BrickedVolumeWriter<DGtal::uint32_t> writer;
+  writer.open( "testBrickedVolume32.bvol", BrickedVolumeWriter<DGtal::uint32_t>::Vector( 21, 7, 10 ), 2 );
+  const std::size_t sliceSize = 21 * 7;
+  for ( unsigned int z = 0; z < 9; ++z )
+    writer.addSlice( limage.begin() + z * sliceSize );
+  trace.info() << writer << std::endl;
+  nbok += ( ! writer.close() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "close() fails on a missing slice" << std::endl;
+  writer.open( "testBrickedVolume32.bvol", BrickedVolumeWriter<DGtal::uint32_t>::Vector( 21, 7, 10 ), 2 );
+  for ( unsigned int z = 0; z < 10; ++z )
+    writer.addSlice( limage.begin() + z * sliceSize );
+  nbok += writer.close() ? 1 : 0;
+  nb++;
+  LImage lread = BrickedVolumeReader<LImage>::importBrickedVolume( "testBrickedVolume32.bvol" );
+  nbok += std::equal( limage.begin(), limage.end(), lread.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "32 bits values" << std::endl;
+
+  bool thrown = false;
+  try
+    {
+      // values of the wrong size
+      BrickedVolumeReader<Image> wrong( "testBrickedVolume32.bvol" );
+    }
+  catch ( IOException & e )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a wrong value size" << std::endl;
+
+  // regions which are not inside the volume
+  Z3i::Domain rois[ 2 ] = { Z3i::Domain( Z3i::Point( 5, 12, 9 ), Z3i::Point( 30, 17, 1000 ) ),
+                            Z3i::Domain( Z3i::Point( 5, 12, 9 ), Z3i::Point( 3, 17, 33 ) ) };
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      thrown = false;
+      try
+        {
+          BrickedVolumeReader<Image>::importBrickedVolume( "testBrickedVolume.bvol", rois[ i ] );
+        }
+      catch ( IOException & e )
+        {
+          thrown = true;
+        }
+      nbok += thrown ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a region outside the volume" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing classes BrickedVolumeWriter and BrickedVolumeReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCodecs() && testBrickedVolume(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
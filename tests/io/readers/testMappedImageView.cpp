@@ -0,0 +1,267 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMappedImageView.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class MappedImageView and the memory-mapped
+ * modes of VolReader, RawReader, LongvolReader, VolWriter and RawWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/MappedImageView.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MappedImageView.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Image1, typename Image2>
+bool sameValues( const Image1 & image1, const Image2 & image2 )
+{
+  if ( image1.domain().size() != image2.domain().size() )
+    return false;
+  typename Image2::Domain::ConstIterator it2 = image2.domain().begin();
+  for ( typename Image1::Domain::ConstIterator it = image1.domain().begin(),
+          itend = image1.domain().end(); it != itend; ++it, ++it2 )
+    if ( image1( *it ) != image2( *it2 ) )
+      return false;
+  return true;
+}
+
+bool testMappedReaders()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mapped readers ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef VolReader<Image>::MappedImage MappedImage;
+  BOOST_CONCEPT_ASSERT(( CConstImage<MappedImage> ));
+  BOOST_CONCEPT_ASSERT(( CImage<MappedImage> ));
+
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  MappedImage view = VolReader<Image>::mapVol( filename );
+  trace.info() << view << endl;
+
+  nbok += ( view.domain().lowerBound() == image.domain().lowerBound()
+            && view.domain().upperBound() == image.domain().upperBound() ) ? 1 : 0;
+  nb++;
+  nbok += ( view.isMapped() && ! view.isWritable() && view.isValid() ) ? 1 : 0;
+  nb++;
+  nbok += sameValues( image, view ) ? 1 : 0;
+  nb++;
+  nbok += std::equal( image.begin(), image.end(), view.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapVol == importVol" << std::endl;
+
+  // the view can be used as any image, and shares its mapping
+  MappedImage copy = view;
+  Z3i::DigitalSet set1( image.domain() ), set2( image.domain() );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( set1, image, 0, 255 );
+  SetFromImage<Z3i::DigitalSet>::append<MappedImage>( set2, copy, 0, 255 );
+  nbok += ( set1.size() == 8043 && set2.size() == set1.size()
+            && std::equal( set1.begin(), set1.end(), set2.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "SetFromImage on the view " << set2.size() << std::endl;
+
+  // raw 8 bits
+  Z3i::Vector ext( 5, 4, 3 );
+  Z3i::Domain domain( Z3i::Point::zero, ext - Z3i::Point::diagonal( 1 ) );
+  Image small( domain );
+  unsigned char v = 0;
+  for ( Image::Iterator it = small.begin(); it != small.end(); ++it )
+    *it = v++ * 3;
+  RawWriter<Image>::exportRaw8( "testMappedImageView.raw", small );
+  RawReader<Image>::MappedImage rawView = RawReader<Image>::mapRaw8( "testMappedImageView.raw", ext );
+  nbok += sameValues( small, rawView ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapRaw8 == image" << std::endl;
+
+  // the view is read-only: the writes are rejected and the file is unchanged
+  unsigned int nbThrown = 0;
+  try
+    {
+      rawView.setValue( Z3i::Point( 1, 2, 1 ), 7 );
+    }
+  catch ( IOException & e )
+    {
+      nbThrown++;
+    }
+  try
+    {
+      rawView.range();
+    }
+  catch ( IOException & e )
+    {
+      nbThrown++;
+    }
+  try
+    {
+      rawView.rowBegin( 0 );
+    }
+  catch ( IOException & e )
+    {
+      nbThrown++;
+    }
+  nbok += ( nbThrown == 3 && sameValues( small, rawView )
+            && sameValues( small, RawReader<Image>::importRaw8( "testMappedImageView.raw", ext ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "writes on the read-only view throw" << std::endl;
+
+  // longvol: values are copied when not aligned in the mapping.
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LImage;
+  LImage limage( domain );
+  DGtal::uint64_t lv = 0;
+  for ( LImage::Iterator it = limage.begin(); it != limage.end(); ++it )
+    *it = 1000 * lv++;
+  LongvolWriter<LImage>::exportLongvol( "testMappedImageView.longvol", limage );
+  LImage limport = LongvolReader<LImage>::importLongvol( "testMappedImageView.longvol" );
+  LongvolReader<LImage>::MappedImage lview = LongvolReader<LImage>::mapLongvol( "testMappedImageView.longvol" );
+  trace.info() << lview << endl;
+  nbok += ( sameValues( limage, lview ) && sameValues( limport, lview ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mapLongvol == importLongvol" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testMappedWriters()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mapped writers ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  Z3i::Domain domain( Z3i::Point( -2, 0, 1 ), Z3i::Point( 6, 4, 3 ) );
+  Image image( domain );
+  unsigned int v = 0;
+  for ( Image::Iterator it = image.begin(); it != image.end(); ++it )
+    *it = (unsigned char)( ( v++ * 7 ) % 256 );
+
+  {
+    VolWriter<Image>::MappedImage out = VolWriter<Image>::createMappedVol( "testMappedImageView.vol", domain );
+    nbok += ( out.isWritable() && out.domain().upperBound() == domain.upperBound() ) ? 1 : 0;
+    nb++;
+    for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      out.setValue( *it, image( *it ) );
+  }
+  Image reread = VolReader<Image>::importVol( "testMappedImageView.vol" );
+  nbok += sameValues( image, reread ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "createMappedVol then importVol" << std::endl;
+
+  {
+    RawWriter<Image>::MappedImage out = RawWriter<Image>::createMappedRaw8( "testMappedImageView2.raw", domain );
+    std::copy( image.begin(), image.end(), out.range().outputIterator() );
+  }
+  RawReader<Image>::MappedImage rawView
+    = RawReader<Image>::mapRaw8( "testMappedImageView2.raw", domain.extent() );
+  nbok += sameValues( image, rawView ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "createMappedRaw8 then mapRaw8" << std::endl;
+
+  bool thrown = false;
+  try
+    {
+      // too small for the domain
+      Z3i::Vector big( 100, 100, 100 );
+      RawReader<Image>::mapRaw8( "testMappedImageView2.raw", big );
+    }
+  catch ( IOException & e )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a too small file" << std::endl;
+
+  //existing files are recreated with zeroed values
+  Image zero( domain );
+  {
+    RawWriter<Image>::MappedImage out = RawWriter<Image>::createMappedRaw8( "testMappedImageView2.raw", domain );
+    nbok += sameValues( zero, out ) ? 1 : 0;
+    nb++;
+  }
+  {
+    VolWriter<Image>::MappedImage out = VolWriter<Image>::createMappedVol( "testMappedImageView.vol", domain );
+    nbok += sameValues( zero, out ) ? 1 : 0;
+    nb++;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "createMappedRaw8 and createMappedVol on existing files" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MappedImageView" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMappedReaders() && testMappedWriters(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -52,11 +52,16 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/kernel/sets/DigitalSetInserter.h"
 
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
 
 #include "DGtal/helpers/StdDefs.h"
 
@@ -347,6 +352,273 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByRuns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns against DigitalSetBySTLSet ..." );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< DigitalSetByRuns<Z3i::Domain> > ));
+  typedef DigitalSetByRuns<Z3i::Domain> RunSet;
+  typedef DigitalSetBySTLSet<Z3i::Domain> RefSet;
+  Z3i::Domain domain( Z3i::Point( -7, -3, -5 ), Z3i::Point( 12, 9, 6 ) );
+  RunSet set1( domain ), set2( domain );
+  RefSet ref1( domain ), ref2( domain );
+
+  //balls, then random insertions and erasures
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( ( *it - Z3i::Point( 1, 2, 0 ) ).norm() < 5.5 )
+        { set1.insertNew( *it ); ref1.insertNew( *it ); }
+      if ( ( *it - Z3i::Point( 5, 3, 1 ) ).norm() < 4.2 )
+        { set2.insertNew( *it ); ref2.insertNew( *it ); }
+    }
+  srand( 0 );
+  bool sameErase = true;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Z3i::Point p( -7 + rand() % 20, -3 + rand() % 13, -5 + rand() % 12 );
+      if ( rand() % 2 )
+        { set1.insert( p ); ref1.insert( p ); }
+      else
+        sameErase = sameErase && ( set1.erase( p ) == ref1.erase( p ) );
+    }
+  INBLOCK_TEST( sameErase );
+  INBLOCK_TEST( set1.isValid() && set2.isValid() );
+  INBLOCK_TEST( ( set1.size() == ref1.size() ) && ( set2.size() == ref2.size() ) );
+  //the points are visited in the order of the domain
+  std::vector<Z3i::Point> forward, forwardUnion;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( ref1( *it ) )
+        forward.push_back( *it );
+      if ( ref1( *it ) || ref2( *it ) )
+        forwardUnion.push_back( *it );
+    }
+  INBLOCK_TEST( std::equal( forward.begin(), forward.end(), set1.begin() ) );
+  bool sameFind = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    sameFind = sameFind && ( set1( *it ) == ref1( *it ) )
+      && ( ( set1.find( *it ) == set1.end() ) || ( *set1.find( *it ) == *it ) );
+  INBLOCK_TEST( sameFind );
+  trace.info() << set1 << " " << set1.memory() << " bytes" << std::endl;
+
+  //backward traversal
+  std::vector<Z3i::Point> backward;
+  for ( RunSet::ConstIterator it = set1.end(), itBegin = set1.begin(); it != itBegin; )
+    backward.push_back( *--it );
+  INBLOCK_TEST( ( backward.size() == forward.size() )
+                && std::equal( backward.begin(), backward.end(), forward.rbegin() ) );
+
+  //runs
+  RunSet::Size nbPoints = 0;
+  bool goodRuns = true;
+  for ( RunSet::RunConstIterator it = set1.runBegin(), itEnd = set1.runEnd(); it != itEnd; ++it )
+    {
+      nbPoints += it.length();
+      goodRuns = goodRuns && set1( it->first ) && set1( it->second )
+        && ( ! set1( it->first - Z3i::Point( 1, 0, 0 ) ) )
+        && ( ! set1( it->second + Z3i::Point( 1, 0, 0 ) ) );
+    }
+  INBLOCK_TEST( goodRuns && ( nbPoints == set1.size() ) );
+
+  //set operations
+  RunSet unionSet( set1 ), differenceSet( set1 ), intersectionSet( set1 );
+  unionSet += set2;
+  differenceSet -= set2;
+  intersectionSet *= set2;
+  RefSet::Size nbDifference = 0, nbIntersection = 0;
+  bool sameOperations = true;
+  for ( RefSet::ConstIterator it = ref1.begin(), itEnd = ref1.end(); it != itEnd; ++it )
+    {
+      nbDifference += ref2( *it ) ? 0 : 1;
+      nbIntersection += ref2( *it ) ? 1 : 0;
+      sameOperations = sameOperations && ( differenceSet( *it ) == ! ref2( *it ) )
+        && ( intersectionSet( *it ) == ref2( *it ) );
+    }
+  INBLOCK_TEST( sameOperations );
+  INBLOCK_TEST( unionSet.isValid() && differenceSet.isValid() && intersectionSet.isValid() );
+  INBLOCK_TEST( std::equal( forwardUnion.begin(), forwardUnion.end(), unionSet.begin() )
+                && ( unionSet.size() == forwardUnion.size() ) );
+  INBLOCK_TEST( ( differenceSet.size() == nbDifference )
+                && ( intersectionSet.size() == nbIntersection ) );
+
+  //complements and bounding box
+  RunSet complement( domain );
+  complement.assignFromComplement( set1 );
+  std::vector<Z3i::Point> complementPoints;
+  std::back_insert_iterator< std::vector<Z3i::Point> > inserter( complementPoints );
+  set1.computeComplement( inserter );
+  INBLOCK_TEST( complement.isValid() && ( complement.size() + set1.size() == domain.size() )
+                && std::equal( complementPoints.begin(), complementPoints.end(), complement.begin() ) );
+  Z3i::Point lower, upper, refLower, refUpper;
+  set2.computeBoundingBox( lower, upper );
+  ref2.computeBoundingBox( refLower, refUpper );
+  INBLOCK_TEST( ( lower == refLower ) && ( upper == refUpper ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Morphology by the neighborhood of an adjacency, point by point.
+ */
+template <typename Set, typename Adjacency>
+bool naiveMorphology( const Set & aSet, const Adjacency & anAdjacency,
+                      const bool isDilation, Set & aResult )
+{
+  typedef typename Set::Point Point;
+  aResult.clear();
+  for ( typename Set::Domain::ConstIterator it = aSet.domain().begin(),
+          itEnd = aSet.domain().end(); it != itEnd; ++it )
+    {
+      std::vector<Point> neighbors;
+      std::back_insert_iterator< std::vector<Point> > inserter( neighbors );
+      anAdjacency.writeNeighbors( inserter, *it );
+      neighbors.push_back( *it );
+      bool found = ! isDilation;
+      for ( typename std::vector<Point>::const_iterator n = neighbors.begin();
+            n != neighbors.end(); ++n )
+        if ( isDilation )
+          found = found || aSet( *n );
+        else
+          found = found && aSet.domain().isInside( *n ) && aSet( *n );
+      if ( found )
+        aResult.insert( *it );
+    }
+  return true;
+}
+
+bool testDigitalSetByBitVector()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByBitVector against DigitalSetBySTLSet ..." );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< DigitalSetByBitVector<Z3i::Domain> > ));
+  typedef DigitalSetByBitVector<Z3i::Domain> BitSet;
+  typedef DigitalSetBySTLSet<Z3i::Domain> RefSet;
+  //rows of two words
+  Z3i::Domain domain( Z3i::Point( -30, -3, -5 ), Z3i::Point( 69, 9, 6 ) );
+  BitSet set1( domain ), set2( domain );
+  RefSet ref1( domain ), ref2( domain );
+
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( ( *it - Z3i::Point( 30, 2, 0 ) ).norm() < 6.5 )
+        { set1.insertNew( *it ); ref1.insertNew( *it ); }
+      if ( ( *it - Z3i::Point( 35, 3, 1 ) ).norm() < 5.2 )
+        { set2.insertNew( *it ); ref2.insertNew( *it ); }
+    }
+  srand( 0 );
+  bool sameErase = true;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Z3i::Point p( -30 + rand() % 100, -3 + rand() % 13, -5 + rand() % 12 );
+      if ( rand() % 2 )
+        { set1.insert( p ); ref1.insert( p ); }
+      else
+        sameErase = sameErase && ( set1.erase( p ) == ref1.erase( p ) );
+    }
+  INBLOCK_TEST( sameErase );
+  INBLOCK_TEST( set1.isValid() && set2.isValid() );
+  INBLOCK_TEST( ( set1.size() == ref1.size() ) && ( set2.size() == ref2.size() ) );
+
+  //the points are visited in the order of the domain
+  std::vector<Z3i::Point> forward;
+  bool sameFind = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( ref1( *it ) )
+        forward.push_back( *it );
+      sameFind = sameFind && ( set1( *it ) == ref1( *it ) )
+        && ( ( set1.find( *it ) == set1.end() ) || ( *set1.find( *it ) == *it ) );
+    }
+  INBLOCK_TEST( sameFind );
+  INBLOCK_TEST( std::equal( forward.begin(), forward.end(), set1.begin() ) );
+  std::vector<Z3i::Point> backward;
+  for ( BitSet::ConstIterator it = set1.end(), itBegin = set1.begin(); it != itBegin; )
+    backward.push_back( *--it );
+  INBLOCK_TEST( ( backward.size() == forward.size() )
+                && std::equal( backward.begin(), backward.end(), forward.rbegin() ) );
+  trace.info() << set1 << " " << set1.memory() << " bytes" << std::endl;
+
+  //set operations
+  BitSet unionSet( set1 ), differenceSet( set1 ), intersectionSet( set1 );
+  unionSet += set2;
+  differenceSet -= set2;
+  intersectionSet *= set2;
+  bool sameOperations = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    sameOperations = sameOperations
+      && ( unionSet( *it ) == ( ref1( *it ) || ref2( *it ) ) )
+      && ( differenceSet( *it ) == ( ref1( *it ) && ! ref2( *it ) ) )
+      && ( intersectionSet( *it ) == ( ref1( *it ) && ref2( *it ) ) );
+  INBLOCK_TEST( sameOperations && unionSet.isValid() && differenceSet.isValid()
+                && intersectionSet.isValid() );
+
+  //complements and bounding box
+  BitSet complement( domain );
+  complement.assignFromComplement( set1 );
+  std::vector<Z3i::Point> complementPoints;
+  std::back_insert_iterator< std::vector<Z3i::Point> > inserter( complementPoints );
+  set1.computeComplement( inserter );
+  INBLOCK_TEST( complement.isValid() && ( complement.size() + set1.size() == domain.size() )
+                && ( complementPoints.size() == complement.size() )
+                && std::equal( complementPoints.begin(), complementPoints.end(), complement.begin() ) );
+  Z3i::Point lower, upper, refLower, refUpper;
+  set2.computeBoundingBox( lower, upper );
+  ref2.computeBoundingBox( refLower, refUpper );
+  INBLOCK_TEST( ( lower == refLower ) && ( upper == refUpper ) );
+
+  //morphology
+  BitSet dilated6( set1 ), eroded6( set1 ), dilated26( set1 ), eroded26( set1 );
+  BitSet naive( domain );
+  dilated6.dilate( Z3i::Adj6() );
+  eroded6.erode( Z3i::Adj6() );
+  dilated26.dilate( Z3i::Adj26() );
+  eroded26.erode( Z3i::Adj26() );
+  naiveMorphology( set1, Z3i::Adj6(), true, naive );
+  bool sameMorphology = std::equal( naive.begin(), naive.end(), dilated6.begin() )
+    && ( naive.size() == dilated6.size() );
+  naiveMorphology( set1, Z3i::Adj6(), false, naive );
+  sameMorphology = sameMorphology && std::equal( naive.begin(), naive.end(), eroded6.begin() )
+    && ( naive.size() == eroded6.size() );
+  naiveMorphology( set1, Z3i::Adj26(), true, naive );
+  sameMorphology = sameMorphology && std::equal( naive.begin(), naive.end(), dilated26.begin() )
+    && ( naive.size() == dilated26.size() );
+  naiveMorphology( set1, Z3i::Adj26(), false, naive );
+  sameMorphology = sameMorphology && std::equal( naive.begin(), naive.end(), eroded26.begin() )
+    && ( naive.size() == eroded26.size() );
+  INBLOCK_TEST( sameMorphology && dilated6.isValid() && eroded26.isValid() );
+  trace.info() << "dilation 26: " << dilated26 << ", erosion 26: " << eroded26 << std::endl;
+
+  //thresholding of an image and back
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    image.setValue( *it, ref1( *it ) ? 200 : ( ref2( *it ) ? 100 : 0 ) );
+  BitSet thresholded( domain );
+  SetFromImage<BitSet>::append<Image>( thresholded, image, 150, 255 );
+  Image image2( domain );
+  ImageFromSet<Image>::append<BitSet>( image2, 200, thresholded.begin(), thresholded.end() );
+  bool sameImage = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    sameImage = sameImage && ( image2( *it ) == ( ref1( *it ) ? 200 : 0 ) );
+  INBLOCK_TEST( ( thresholded.size() == ref1.size() ) && sameImage );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   
@@ -383,6 +655,16 @@ int main()
     ( DigitalSetBySTLSet<Domain>(domain), DigitalSetBySTLSet<Domain>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByRuns" );
+  bool okRuns = testDigitalSet< DigitalSetByRuns<Domain> >
+    ( DigitalSetByRuns<Domain>(domain), DigitalSetByRuns<Domain>(domain) );
+  trace.endBlock();
+
+  trace.beginBlock( "DigitalSetByBitVector" );
+  bool okBits = testDigitalSet< DigitalSetByBitVector<Domain> >
+    ( DigitalSetByBitVector<Domain>(domain), DigitalSetByBitVector<Domain>(domain) );
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetFromMap" );
   typedef ImageContainerBySTLMap<Domain,short int> Map;
   Map map(domain); Map map2(domain);        //maps
@@ -403,15 +685,24 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorBigHVar = testDigitalSetSelector
+      < Domain, BIG_DS + HIGH_VAR_DS + HIGH_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Big set + High variability" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
+  bool okDigitalSetByRuns = testDigitalSetByRuns();
+
+  bool okDigitalSetByBitVector = testDigitalSetByBitVector();
+
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet && okMap
-      && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
-  && okDigitalSetDomain && okDigitalSetDraw ;  trace.endBlock();
+  bool res = okVector && okSet && okMap && okRuns && okBits
+      && okSelectorSmall && okSelectorBig && okSelectorMediumHBel && okSelectorBigHVar
+  && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetByRuns
+  && okDigitalSetByBitVector ;  trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
 }
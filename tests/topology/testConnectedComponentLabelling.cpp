@@ -0,0 +1,228 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConnectedComponentLabelling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/helpers/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random set of a domain.
+ */
+template <typename DigitalSet>
+DigitalSet randomSet( const typename DigitalSet::Domain & domain, int percent )
+{
+  DigitalSet set( domain );
+  for ( typename DigitalSet::Domain::ConstIterator it = domain.begin(),
+          itEnd = domain.end(); it != itEnd; ++it )
+    if ( rand() % 100 < percent )
+      set.insertNew( *it );
+  return set;
+}
+
+/**
+ * Compares the labelling of a random set to the components given by
+ * Object::writeComponents, for several numbers of tiles.
+ */
+template <typename TObject>
+bool testLabelling( const typename TObject::DigitalTopology & topology,
+                    const typename TObject::Domain & domain,
+                    int percent )
+{
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Point Point;
+  typedef typename TObject::DigitalTopology::ForegroundAdjacency Adjacency;
+  typedef ImageContainerBySTLVector<typename TObject::Domain, unsigned int> LabelImage;
+  typedef ConnectedComponentLabelling<Adjacency, LabelImage> Labelling;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Labelling of a random set..." );
+  DigitalSet set = randomSet<DigitalSet>( domain, percent );
+  TObject object( topology, set );
+  std::vector<TObject> components;
+  back_insert_iterator< std::vector<TObject> > inserter( components );
+  unsigned int nbComponents = object.writeComponents( inserter );
+
+  Labelling labelling( topology.kappa() );
+  trace.info() << labelling << std::endl;
+  LabelImage labels( domain );
+  unsigned int nbLabels = labelling.computeFromSet( set, labels, 1 );
+  trace.info() << set.size() << " points, " << nbComponents
+               << " components, " << nbLabels << " labels" << std::endl;
+  nbok += ( nbLabels == nbComponents ) ? 1 : 0;
+  nb++;
+
+  //Each component has a single label, with the right statistics
+  bool ok = true;
+  std::vector<bool> used( nbLabels + 1, false );
+  for ( unsigned int c = 0; c < components.size(); ++c )
+    {
+      const DigitalSet & points = components[ c ].pointSet();
+      const unsigned int label = labels( *points.begin() );
+      ok = ok && ( label > 0 ) && ( label <= nbLabels ) && ! used[ label ];
+      if ( ! ok ) break;
+      used[ label ] = true;
+      Point lower = *points.begin();
+      Point upper = lower;
+      for ( typename DigitalSet::ConstIterator it = points.begin(),
+              itEnd = points.end(); it != itEnd; ++it )
+        {
+          ok = ok && ( labels( *it ) == label );
+          lower = lower.inf( *it );
+          upper = upper.sup( *it );
+        }
+      const typename Labelling::ComponentStatistics & stats
+        = labelling.statistics()[ label-1 ];
+      ok = ok && ( stats.size == points.size() )
+        && ( stats.lowerBound == lower ) && ( stats.upperBound == upper );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "components == labels" << std::endl;
+
+  //Background
+  unsigned int nbBackground = 0;
+  for ( typename LabelImage::ConstIterator it = labels.begin(),
+          itEnd = labels.end(); it != itEnd; ++it )
+    nbBackground += ( *it == 0 ) ? 1 : 0;
+  nbok += ( nbBackground + set.size() == domain.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "background size" << std::endl;
+
+  //Tiles, the set being used as a point predicate
+  const unsigned int tiles[] = { 0, 2, 3, 7, 1000 };
+  for ( unsigned int t = 0; t < 5; ++t )
+    {
+      LabelImage tiledLabels( domain );
+      unsigned int nbTiled = labelling.compute( set, tiledLabels, tiles[ t ] );
+      bool same = ( nbTiled == nbLabels );
+      for ( typename LabelImage::ConstIterator it = labels.begin(), itEnd = labels.end(),
+              itt = tiledLabels.begin(); same && ( it != itEnd ); ++it, ++itt )
+        same = ( *it == *itt );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << tiles[ t ] << " tiles, " << nbTiled << " labels" << std::endl;
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Labelling of a small 2D set for the 4- and 8-adjacencies.
+ */
+bool testSimpleLabelling()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Labelling of a small set..." );
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> LabelImage;
+  Z2i::Domain domain( Z2i::Point( -2, -2 ), Z2i::Point( 2, 2 ) );
+  Z2i::DigitalSet ring( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( ( (*it).norm( Z2i::Point::L_infty ) == 1 ) && ( (*it)[ 0 ] != 0 ) )
+      ring.insertNew( *it );
+  ring.insertNew( Z2i::Point( 0, 2 ) );
+
+  LabelImage labels( domain );
+  ConnectedComponentLabelling<Z2i::Adj4, LabelImage> labelling4( Z2i::adj4 );
+  nbok += ( labelling4.computeFromSet( ring, labels ) == 3 ) ? 1 : 0;
+  nb++;
+  nbok += ( labels( Z2i::Point( -1, -1 ) ) == 1 )
+    && ( labels( Z2i::Point( 1, -1 ) ) == 2 )
+    && ( labels( Z2i::Point( 0, 2 ) ) == 3 )
+    && ( labels( Z2i::Point( 0, 0 ) ) == 0 ) ? 1 : 0;
+  nb++;
+  nbok += ( labelling4.statistics()[ 0 ].size == 3 )
+    && ( labelling4.statistics()[ 0 ].lowerBound == Z2i::Point( -1, -1 ) )
+    && ( labelling4.statistics()[ 0 ].upperBound == Z2i::Point( -1, 1 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "4-adjacency: three components" << std::endl;
+
+  ConnectedComponentLabelling<Z2i::Adj8, LabelImage> labelling8( Z2i::adj8 );
+  nbok += ( labelling8.computeFromSet( ring, labels ) == 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( labelling8.statistics()[ 0 ].size == 7 )
+    && ( labelling8.statistics()[ 0 ].upperBound == Z2i::Point( 1, 2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "8-adjacency: one component" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  Z2i::Domain domain2( Z2i::Point( -10, -7 ), Z2i::Point( 25, 30 ) );
+  Z3i::Domain domain3( Z3i::Point( -3, 0, -5 ), Z3i::Point( 10, 8, 12 ) );
+  bool res = testSimpleLabelling()
+    && testLabelling<Z2i::Object4_8>( Z2i::dt4_8, domain2, 50 )
+    && testLabelling<Z2i::Object8_4>( Z2i::dt8_4, domain2, 40 )
+    && testLabelling<Z3i::Object6_26>( Z3i::dt6_26, domain3, 30 )
+    && testLabelling<Z3i::Object26_6>( Z3i::dt26_6, domain3, 15 )
+    && testLabelling<Z3i::Object18_6>( Z3i::dt18_6, domain3, 20 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
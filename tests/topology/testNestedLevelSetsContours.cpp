@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNestedLevelSetsContours.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class NestedLevelSetsContours.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/NestedLevelSetsContours.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image;
+typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> LevelImage;
+typedef NestedLevelSetsContours<Z2i::KSpace, LevelImage> Extractor;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NestedLevelSetsContours.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that the contours of each level are exactly those given by
+ * Surfaces::extractAll2DSCellContours and
+ * Surfaces::extractAllPointContours4C (and its parallel version)
+ * with an IntervalThresholder, as pgm2freeman -thresholdRange does.
+ */
+bool testNestedLevelSetsContours( const Image & image,
+                                  unsigned char minThreshold,
+                                  unsigned char increment,
+                                  bool interiorAdj )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing NestedLevelSetsContours ..." );
+  Z2i::KSpace K;
+  K.init( image.domain().lowerBound(), image.domain().upperBound(), true );
+  SurfelAdjacency<2> SAdj( interiorAdj );
+
+  std::vector<unsigned char> maxThresholds;
+  for ( unsigned int t = minThreshold + increment; t < 255; t += increment )
+    maxThresholds.push_back( (unsigned char) t );
+  LevelImage levels( image.domain() );
+  Extractor::computeIntervalLevels( levels, image, minThreshold, maxThresholds );
+  Extractor extractor;
+  extractor.init( K, SAdj, levels, (unsigned int) maxThresholds.size() );
+  nbok += extractor.isValid() ? 1 : 0;
+  nb++;
+  while ( extractor.nextLevel() )
+    {
+      typedef IntervalThresholder<unsigned char> Binarizer;
+      Binarizer b( minThreshold, maxThresholds[ extractor.level() ] );
+      PointFunctorPredicate<Image, Binarizer> predicate( image, b );
+
+      std::vector< std::vector<Z2i::SCell> > contours, expContours;
+      extractor.getSCellContours( contours );
+      Surfaces<Z2i::KSpace>::extractAll2DSCellContours
+        ( expContours, K, SAdj, predicate );
+      std::vector< std::vector<Z2i::Point> > points, expPoints;
+      extractor.getPointContours( points );
+      Surfaces<Z2i::KSpace>::extractAllPointContours4C
+        ( expPoints, K, predicate, SAdj );
+      std::vector< std::vector<Z2i::Point> > parallelPoints;
+      Surfaces<Z2i::KSpace>::extractAllPointContours4CParallel
+        ( parallelPoints, K, predicate, SAdj, 3 );
+      nbok += ( contours == expContours
+                && points == expPoints
+                && parallelPoints == expPoints
+                && extractor.nbContours() == expContours.size() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "[" << (int) minThreshold << ","
+                   << (int) maxThresholds[ extractor.level() ] << "] "
+                   << extractor.nbContours() << " contours" << std::endl;
+    }
+  nbok += ( extractor.level() + 1 == (int) maxThresholds.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << extractor << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class NestedLevelSetsContours" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Image image = PNMReader<Image>::importPGM( testPath + "samples/church-small.pgm" );
+  bool res = testNestedLevelSetsContours( image, 0, 25, true )
+    && testNestedLevelSetsContours( image, 60, 10, false );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,478 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplePointOracle.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes SimplePointOracle and HomotopicThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/SimplePointOracle.h"
+#include "DGtal/topology/helpers/HomotopicThinning.h"
+#include "DGtal/topology/helpers/ConnectedComponentLabelling.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SimplePointOracle.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the oracle to Object::isSimple on all the configurations
+ * of a 2D topology.
+ */
+template <typename TObject>
+bool testOracle2D( const typename TObject::DigitalTopology & topology )
+{
+  typedef typename TObject::DigitalTopology DigitalTopology;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Point Point;
+  typedef typename DigitalSet::Domain Domain;
+  typedef SimplePointOracle<DigitalTopology> Oracle;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Simple points: oracle vs Object::isSimple..." );
+  Oracle oracle( topology );
+  trace.info() << oracle << std::endl;
+  nbok += oracle.isValid() ? 1 : 0;
+  nb++;
+
+  const Point c = Point::diagonal( 0 );
+  Domain domain( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  DigitalSet set( domain );
+  TObject object( topology, set );
+  unsigned int nbSame = 0;
+  unsigned int nbSimple = 0;
+  for ( typename Oracle::Configuration cfg = 0; cfg < 256; ++cfg )
+    {
+      object.pointSet().clear();
+      object.pointSet().insert( c );
+      for ( unsigned int k = 0; k < oracle.size(); ++k )
+        if ( cfg & ( 1u << k ) )
+          object.pointSet().insert( c + oracle.offset( k ) );
+
+      const bool simple = object.isSimple( c );
+      nbSame += ( oracle.configuration( object.pointSet(), c ) == cfg )
+        && ( oracle.isSimple( cfg ) == simple )
+        && ( oracle.computeSimplicity( cfg ) == simple ) ? 1 : 0;
+      nbSimple += simple ? 1 : 0;
+    }
+  nbok += ( nbSame == 256 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbSame << "/256 configurations ("
+               << nbSimple << " simple)" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * @return the Euler characteristic of the union of the closed unit
+ * cubes centered on the points of a 3D set.
+ */
+int eulerCharacteristic( const Z3i::DigitalSet & aSet )
+{
+  //cells of the cubical complex in doubled coordinates, the dimension
+  //of a cell being the number of its even coordinates
+  std::set<Z3i::Point> cells;
+  for ( Z3i::DigitalSet::ConstIterator it = aSet.begin(), itEnd = aSet.end();
+        it != itEnd; ++it )
+    for ( int x = -1; x <= 1; ++x )
+      for ( int y = -1; y <= 1; ++y )
+        for ( int z = -1; z <= 1; ++z )
+          cells.insert( Z3i::Point( 2 * (*it)[ 0 ] + x, 2 * (*it)[ 1 ] + y,
+                                    2 * (*it)[ 2 ] + z ) );
+  int chi = 0;
+  for ( std::set<Z3i::Point>::const_iterator it = cells.begin(), itEnd = cells.end();
+        it != itEnd; ++it )
+    {
+      const int dim = ( ( (*it)[ 0 ] & 1 ) == 0 ) + ( ( (*it)[ 1 ] & 1 ) == 0 )
+        + ( ( (*it)[ 2 ] & 1 ) == 0 );
+      chi += ( dim % 2 == 0 ) ? 1 : -1;
+    }
+  return chi;
+}
+
+/**
+ * Checks the oracle on random 3D configurations: the removal of a
+ * simple point preserves the numbers of components of the object and
+ * of its complement and the Euler characteristic of the 26-connected
+ * one (the converse is not true: these global invariants may be
+ * preserved by the removal of a point which is not simple).
+ */
+template <typename TDigitalTopology>
+bool testOracle3D( const TDigitalTopology & topology, unsigned int nbCfg )
+{
+  typedef SimplePointOracle<TDigitalTopology> Oracle;
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> LabelImage;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Simple points: oracle vs topological invariants..." );
+  Oracle oracle( topology );
+  trace.info() << oracle << std::endl;
+  nbok += oracle.isValid() ? 1 : 0;
+  nb++;
+
+  const bool kappa26 = ( oracle.kappaNeighbors() == ( 1u << 26 ) - 1 );
+  Z3i::Domain domain( Z3i::Point::diagonal( -2 ), Z3i::Point::diagonal( 2 ) );
+  LabelImage labels( domain );
+  ConnectedComponentLabelling<typename TDigitalTopology::ForegroundAdjacency, LabelImage>
+    kappaLabelling( topology.kappa() );
+  ConnectedComponentLabelling<typename TDigitalTopology::BackgroundAdjacency, LabelImage>
+    lambdaLabelling( topology.lambda() );
+  unsigned int nbValid = 0;
+  unsigned int nbSimple = 0;
+  for ( unsigned int i = 0; i < nbCfg; ++i )
+    {
+      const typename Oracle::Configuration cfg =
+        ( ( (typename Oracle::Configuration) rand() << 16 )
+          ^ (typename Oracle::Configuration) rand() ) & ( ( 1u << 26 ) - 1 );
+      Z3i::DigitalSet X( domain );
+      X.insert( Z3i::Point::zero );
+      for ( unsigned int k = 0; k < oracle.size(); ++k )
+        if ( cfg & ( 1u << k ) )
+          X.insert( oracle.offset( k ) );
+      Z3i::DigitalSet Y( X );
+      Y.erase( Z3i::Point::zero );
+      Z3i::DigitalSet complementX( domain );
+      Z3i::DigitalSet complementY( domain );
+      complementX.assignFromComplement( X );
+      complementY.assignFromComplement( Y );
+
+      const bool invariants =
+        ( kappaLabelling.computeFromSet( X, labels ) == kappaLabelling.computeFromSet( Y, labels ) )
+        && ( lambdaLabelling.computeFromSet( complementX, labels )
+             == lambdaLabelling.computeFromSet( complementY, labels ) )
+        && ( kappa26 ? ( eulerCharacteristic( X ) == eulerCharacteristic( Y ) )
+             : ( eulerCharacteristic( complementX ) == eulerCharacteristic( complementY ) ) );
+      const bool simple = oracle.isSimple( cfg );
+      nbValid += ( oracle.configuration( X, Z3i::Point::zero ) == cfg )
+        && ( ! simple || invariants ) ? 1 : 0;
+      nbSimple += simple ? 1 : 0;
+    }
+  nbok += ( nbValid == nbCfg ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbValid << "/" << nbCfg << " configurations ("
+               << nbSimple << " simple)" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the oracle on a few 3D configurations.
+ */
+bool testOracleExamples()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Simple points in 3D..." );
+  SimplePointOracle<Z3i::DT26_6> oracle26_6( Z3i::dt26_6 );
+  SimplePointOracle<Z3i::DT6_26> oracle6_26( Z3i::dt6_26 );
+  SimplePointOracle<Z3i::DT6_18> oracle6_18( Z3i::dt6_18 );
+  nbok += ( oracle26_6.size() == 26 ) && ! oracle6_18.isValid() ? 1 : 0;
+  nb++;
+
+  //isolated point, interior point
+  const SimplePointOracle<Z3i::DT26_6>::Configuration full = ( 1u << 26 ) - 1;
+  nbok += ! oracle26_6.isSimple( 0 ) && ! oracle26_6.isSimple( full )
+    && ! oracle6_26.isSimple( 0 ) && ! oracle6_26.isSimple( full ) ? 1 : 0;
+  nb++;
+
+  //end of a curve, point of a curve
+  Z3i::Domain domain( Z3i::Point( -1, -1, -1 ), Z3i::Point( 1, 1, 1 ) );
+  Z3i::DigitalSet curve( domain );
+  curve.insert( Z3i::Point( -1, 0, 0 ) );
+  nbok += oracle26_6.isSimple( curve, Z3i::Point::zero )
+    && oracle6_26.isSimple( curve, Z3i::Point::zero ) ? 1 : 0;
+  nb++;
+  curve.insert( Z3i::Point( 1, 1, 0 ) );
+  nbok += ! oracle26_6.isSimple( curve, Z3i::Point::zero ) ? 1 : 0;
+  nb++;
+
+  //the 6-curve x, (1,0,0), (1,0,1), (1,1,1), (0,1,1), (0,1,0) is a
+  //closed 6-curve: x is not 6-simple although the corner (1,1,1)
+  //joins its two 6-neighbors in the 26-neighborhood.
+  Z3i::DigitalSet loop( domain );
+  loop.insert( Z3i::Point( 1, 0, 0 ) );
+  loop.insert( Z3i::Point( 1, 0, 1 ) );
+  loop.insert( Z3i::Point( 1, 1, 1 ) );
+  loop.insert( Z3i::Point( 0, 1, 1 ) );
+  loop.insert( Z3i::Point( 0, 1, 0 ) );
+  nbok += ! oracle6_26.isSimple( loop, Z3i::Point::zero ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "isolated, interior, curve and loop points" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Thins a set and checks that the number of components of the set
+ * and of its complement, and the anchors, are preserved, and that no
+ * point of the result is simple.
+ */
+template <typename TObject>
+bool testThinning( const typename TObject::DigitalTopology & topology,
+                   const typename TObject::DigitalSet & aSet,
+                   bool keepEndPoints )
+{
+  typedef typename TObject::DigitalTopology DigitalTopology;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::Point Point;
+  typedef ImageContainerBySTLVector<Domain, unsigned int> LabelImage;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Homotopic thinning..." );
+  const Domain & domain = aSet.domain();
+  DigitalSet complement( domain );
+  complement.assignFromComplement( aSet );
+  LabelImage labels( domain );
+  ConnectedComponentLabelling<typename DigitalTopology::ForegroundAdjacency, LabelImage>
+    kappaLabelling( topology.kappa() );
+  ConnectedComponentLabelling<typename DigitalTopology::BackgroundAdjacency, LabelImage>
+    lambdaLabelling( topology.lambda() );
+  const unsigned int nbComponents = kappaLabelling.computeFromSet( aSet, labels );
+  const unsigned int nbHoles = lambdaLabelling.computeFromSet( complement, labels );
+
+  //reference: sequential thinning with Object::isSimple
+  TObject object( topology, aSet );
+  unsigned int nbRemoved = 0;
+  do
+    {
+      nbRemoved = 0;
+      std::vector<Point> points( object.pointSet().begin(), object.pointSet().end() );
+      for ( unsigned int i = 0; i < points.size(); ++i )
+        if ( object.isSimple( points[ i ] ) )
+          {
+            object.pointSet().erase( points[ i ] );
+            ++nbRemoved;
+          }
+    }
+  while ( nbRemoved != 0 );
+
+  HomotopicThinning<DigitalTopology> thinning( topology );
+  DigitalSet thin( aSet );
+  const unsigned int nbThinRemoved = thinning.thin( thin, keepEndPoints );
+  trace.info() << thinning << ": " << aSet.size() << " -> " << thin.size()
+               << " points (" << nbThinRemoved << " removed, "
+               << object.size() << " with Object::isSimple)" << std::endl;
+  nbok += ( thin.size() + nbThinRemoved == aSet.size() ) ? 1 : 0;
+  nb++;
+
+  bool inside = true;
+  for ( typename DigitalSet::ConstIterator it = thin.begin(), itEnd = thin.end();
+        it != itEnd; ++it )
+    inside = inside && aSet( *it );
+  nbok += inside ? 1 : 0;
+  nb++;
+
+  DigitalSet thinComplement( domain );
+  thinComplement.assignFromComplement( thin );
+  const unsigned int nbThinComponents = kappaLabelling.computeFromSet( thin, labels );
+  const unsigned int nbThinHoles = lambdaLabelling.computeFromSet( thinComplement, labels );
+  nbok += ( nbThinComponents == nbComponents ) && ( nbThinHoles == nbHoles ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbComponents << " components, " << nbHoles << " holes before, "
+               << nbThinComponents << " components, " << nbThinHoles << " holes after"
+               << std::endl;
+
+  //the reference has the same topology and no simple point for the oracle
+  SimplePointOracle<DigitalTopology> oracle( topology );
+  const DigitalSet & reference = object.pointSet();
+  DigitalSet referenceComplement( domain );
+  referenceComplement.assignFromComplement( reference );
+  bool noSimpleInReference = true;
+  for ( typename DigitalSet::ConstIterator it = reference.begin(), itEnd = reference.end();
+        it != itEnd; ++it )
+    noSimpleInReference = noSimpleInReference && ! oracle.isSimple( reference, *it );
+  nbok += ( kappaLabelling.computeFromSet( reference, labels ) == nbComponents )
+    && ( lambdaLabelling.computeFromSet( referenceComplement, labels ) == nbHoles )
+    && noSimpleInReference ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same topology and no simple point with Object::isSimple" << std::endl;
+
+  //without end points, the thinning is a homotopic kernel
+  if ( ! keepEndPoints )
+    {
+      bool noSimple = true;
+      for ( typename DigitalSet::ConstIterator it = thin.begin(), itEnd = thin.end();
+            it != itEnd; ++it )
+        noSimple = noSimple && ! oracle.isSimple( thin, *it );
+      nbok += noSimple ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "no simple point left" << std::endl;
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Thinning of a set with anchors and, with OpenMP, with several
+ * numbers of threads.
+ */
+bool testThinningAnchors()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Homotopic thinning with anchors..." );
+  Z2i::Domain domain( Z2i::Point( -10, -10 ), Z2i::Point( 10, 10 ) );
+  Z2i::DigitalSet square( domain );
+  Z2i::DigitalSet anchors( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( (*it).norm( Z2i::Point::L_infty ) <= 6 )
+      square.insertNew( *it );
+  anchors.insertNew( Z2i::Point( 6, 6 ) );
+  anchors.insertNew( Z2i::Point( -6, 6 ) );
+
+  HomotopicThinning<Z2i::DT8_4> thinning( Z2i::dt8_4 );
+  Z2i::DigitalSet thin( square );
+  thinning.thin( thin, anchors, false );
+  nbok += thin( Z2i::Point( 6, 6 ) ) && thin( Z2i::Point( -6, 6 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << thin.size() << " points, anchors kept" << std::endl;
+
+  Z2i::DigitalSet single( square );
+  thinning.thin( single, false );
+  nbok += ( single.size() == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "a square is thinned to a point" << std::endl;
+
+#ifdef WITH_OPENMP
+  //the result does not depend on the number of threads
+  const int nbThreads = omp_get_max_threads();
+  bool sameResults = true;
+  for ( int n = 1; n <= 4; ++n )
+    {
+      omp_set_num_threads( n );
+      Z2i::DigitalSet other( square );
+      thinning.thin( other, anchors, false );
+      sameResults = sameResults && ( other.size() == thin.size() );
+      for ( Z2i::DigitalSet::ConstIterator it = other.begin(), itEnd = other.end();
+            it != itEnd; ++it )
+        sameResults = sameResults && thin( *it );
+    }
+  omp_set_num_threads( nbThreads );
+  nbok += sameResults ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same result with 1 to 4 threads" << std::endl;
+#endif
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Random set of a domain.
+ */
+template <typename DigitalSet>
+DigitalSet randomSet( const typename DigitalSet::Domain & domain, int percent )
+{
+  DigitalSet set( domain );
+  for ( typename DigitalSet::Domain::ConstIterator it = domain.begin(),
+          itEnd = domain.end(); it != itEnd; ++it )
+    if ( rand() % 100 < percent )
+      set.insertNew( *it );
+  return set;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing classes SimplePointOracle and HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  Z2i::Domain domain2( Z2i::Point( -1, -1 ), Z2i::Point( 30, 25 ) );
+  Z3i::Domain domain3( Z3i::Point( -1, -1, -1 ), Z3i::Point( 12, 10, 11 ) );
+  //the border of the domains remains in the background
+  Z2i::Domain inside2( Z2i::Point( 0, 0 ), Z2i::Point( 29, 24 ) );
+  Z3i::Domain inside3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 11, 9, 10 ) );
+  Z2i::DigitalSet set2( domain2 );
+  Z2i::DigitalSet random2 = randomSet<Z2i::DigitalSet>( inside2, 70 );
+  set2.insertNew( random2.begin(), random2.end() );
+  Z3i::DigitalSet set3( domain3 );
+  Z3i::DigitalSet random3 = randomSet<Z3i::DigitalSet>( inside3, 75 );
+  set3.insertNew( random3.begin(), random3.end() );
+
+  bool res = testOracle2D<Z2i::Object4_8>( Z2i::dt4_8 )
+    && testOracle2D<Z2i::Object8_4>( Z2i::dt8_4 )
+    && testOracle3D( Z3i::dt26_6, 500 )
+    && testOracle3D( Z3i::dt6_26, 500 )
+    && testOracleExamples()
+    && testThinning<Z2i::Object4_8>( Z2i::dt4_8, set2, false )
+    && testThinning<Z2i::Object8_4>( Z2i::dt8_4, set2, false )
+    && testThinning<Z2i::Object8_4>( Z2i::dt8_4, set2, true )
+    && testThinning<Z3i::Object26_6>( Z3i::dt26_6, set3, false )
+    && testThinning<Z3i::Object6_26>( Z3i::dt6_26, set3, false )
+    && testThinning<Z3i::Object26_6>( Z3i::dt26_6, set3, true )
+    && testThinningAnchors();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
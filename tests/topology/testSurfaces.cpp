@@ -0,0 +1,355 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaces.cpp
+ * @ingroup Tests
+ * @author Bertrand Kerautret (\c kerautre@loria.fr )
+ * LORIA (CNRS, UMR 7503), University of Nancy, France
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the boundary extraction services of class Surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/DenseSurfelMarker.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Surfaces.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that DenseSurfelMarker associates distinct bits to distinct
+ * surfels and ignores signs.
+ */
+template <typename KSpace>
+bool testDenseSurfelMarker()
+{
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing DenseSurfelMarker ..." );
+  KSpace K;
+  Point low = Point::diagonal( -3 );
+  Point high = Point::diagonal( 4 );
+  K.init( low, high, true );
+  DenseSurfelMarker<KSpace> marker( K );
+  std::set<typename DenseSurfelMarker<KSpace>::Size> indices;
+  unsigned int nbSurfels = 0;
+  bool allUnmarked = true;
+  typedef HyperRectDomain<typename KSpace::Space> Domain;
+  Domain domain( low, high );
+  for ( typename Domain::ConstIterator it = domain.begin(),
+          it_end = domain.end(); it != it_end; ++it )
+    for ( Dimension k = 0; k < KSpace::dimension; ++k )
+      {
+        SCell surfels[ 2 ] = { K.sIncident( K.sSpel( *it ), k, false ),
+                               K.sIncident( K.sSpel( *it ), k, true ) };
+        for ( unsigned int j = 0; j < 2; ++j )
+          {
+            // upper surfels are shared with the next spel, except on
+            // the border of the space.
+            if ( j == 1 && (*it)[ k ] != high[ k ] ) continue;
+            ++nbSurfels;
+            indices.insert( marker.index( surfels[ j ] ) );
+            allUnmarked = allUnmarked && ! marker.isMarked( surfels[ j ] );
+          }
+      }
+  nbok += ( indices.size() == nbSurfels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "injective index, " << nbSurfels << " surfels" << std::endl;
+  nbok += allUnmarked ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "initially unmarked" << std::endl;
+  SCell s = K.sIncident( K.sSpel( Point::diagonal( 1 ) ), 0, true );
+  bool first = marker.mark( s );
+  bool second = marker.mark( K.sOpp( s ) );
+  nbok += ( first && ! second && marker.isMarked( s ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mark ignores sign" << std::endl;
+  marker.unmark( s );
+  nbok += ( ! marker.isMarked( s ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "unmark" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that tracking with a DenseSurfelMarker gives the same bels
+ * as tracking with a std::set.
+ */
+template <typename KSpace>
+bool testDenseTracking()
+{
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing dense boundary tracking ..." );
+  Point low = Point::diagonal( -8 );
+  Point high = Point::diagonal( 8 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( -2 ), 4 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( 3 ), 3 );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  Point inside = Point::diagonal( -2 );
+  Point outside = inside; outside[ 0 ] = high[ 0 ];
+  SCell bel = Surfaces<KSpace>::findABel( K, shape_set, inside, outside );
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::trackBoundary( bdry, K, SAdj, shape_set, bel );
+  DenseSurfelMarker<KSpace> marker( K );
+  std::vector<SCell> vbdry;
+  Surfaces<KSpace>::trackBoundary( vbdry, marker, K, SAdj, shape_set, bel );
+  std::set<SCell> sbdry( vbdry.begin(), vbdry.end() );
+  nbok += ( vbdry.size() == bdry.size() && sbdry == bdry ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "trackBoundary: " << bdry.size() << " == " << vbdry.size()
+               << std::endl;
+  // Already marked: nothing is tracked.
+  Surfaces<KSpace>::trackBoundary( vbdry, marker, K, SAdj, shape_set, bel );
+  nbok += vbdry.empty() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "marked bels are not tracked again" << std::endl;
+  marker.unmark( sbdry.begin(), sbdry.end() );
+  std::set<SCell> cbdry;
+  Surfaces<KSpace>::trackClosedBoundary( cbdry, K, SAdj, shape_set, bel );
+  Surfaces<KSpace>::trackClosedBoundary( vbdry, marker, K, SAdj, shape_set, bel );
+  sbdry = std::set<SCell>( vbdry.begin(), vbdry.end() );
+  nbok += ( vbdry.size() == cbdry.size() && sbdry == cbdry ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "trackClosedBoundary: " << cbdry.size() << " == "
+               << vbdry.size() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the single sweep extractAllConnectedSCell gives the same
+ * components as the set-based extraction (sMakeBoundary followed by
+ * trackBoundary on each remaining bel).
+ */
+template <typename KSpace>
+bool testExtractAllConnectedSCell()
+{
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing single sweep extractAllConnectedSCell ..." );
+  Point low = Point::diagonal( -10 );
+  Point high = Point::diagonal( 10 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( -5 ), 4 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point::diagonal( -5 ), 2 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point::diagonal( 4 ), 3 );
+  Shapes<Domain>::addNorm2Ball( shape_set, high, 2 ); // touches the border
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+
+  // Reference: set-based extraction.
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, shape_set, low, high );
+  std::set< std::set<SCell> > refComponents;
+  unsigned int refNbBels = bdry.size();
+  while ( ! bdry.empty() )
+    {
+      std::set<SCell> component;
+      Surfaces<KSpace>::trackBoundary( component, K, SAdj, shape_set,
+                                       *( bdry.begin() ) );
+      for ( typename std::set<SCell>::const_iterator it = component.begin(),
+              it_end = component.end(); it != it_end; ++it )
+        bdry.erase( *it );
+      refComponents.insert( component );
+    }
+
+  std::vector<SCell> bels;
+  std::vector<std::size_t> offsets;
+  Surfaces<KSpace>::extractAllConnectedSCell( bels, offsets, K, SAdj, 
+                                              shape_set );
+  std::set< std::set<SCell> > components;
+  for ( std::size_t i = 0; i + 1 < offsets.size(); ++i )
+    components.insert( std::set<SCell>( bels.begin() + offsets[ i ],
+                                        bels.begin() + offsets[ i + 1 ] ) );
+  nbok += ( offsets.back() == bels.size() && bels.size() == refNbBels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nb bels: " << bels.size() << " == " << refNbBels
+               << std::endl;
+  nbok += ( offsets.size() - 1 == refComponents.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nb components: " << offsets.size() - 1 << " == " 
+               << refComponents.size() << std::endl;
+  nbok += ( components == refComponents ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same components" << std::endl;
+  std::vector< std::vector<SCell> > vComponents;
+  Surfaces<KSpace>::extractAllConnectedSCell( vComponents, K, SAdj, 
+                                              shape_set );
+  bool sameNested = vComponents.size() + 1 == offsets.size();
+  for ( std::size_t i = 0; sameNested && i < vComponents.size(); ++i )
+    sameNested = std::equal( vComponents[ i ].begin(), vComponents[ i ].end(),
+                             bels.begin() + offsets[ i ] );
+  nbok += sameNested ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nested version is consistent" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the parallel extractions give the same result as the
+ * sequential ones, whatever the number of slabs.
+ */
+template <typename KSpace>
+bool testParallelExtraction()
+{
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing parallel extractions ..." );
+  Point low = Point::diagonal( -12 );
+  Point high = Point::diagonal( 12 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( -4 ), 7 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point::diagonal( -4 ), 3 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point::diagonal( 6 ), 4 );
+  Shapes<Domain>::addNorm2Ball( shape_set, high, 3 ); // touches the border
+  Shapes<Domain>::addNorm2Ball( shape_set, low, 2 ); // touches the border
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+
+  std::vector<SCell> bels;
+  std::vector<std::size_t> offsets;
+  Surfaces<KSpace>::extractAllConnectedSCell( bels, offsets, K, SAdj, 
+                                              shape_set );
+  std::set< std::set<SCell> > components;
+  for ( std::size_t i = 0; i + 1 < offsets.size(); ++i )
+    components.insert( std::set<SCell>( bels.begin() + offsets[ i ],
+                                        bels.begin() + offsets[ i + 1 ] ) );
+  std::vector< std::vector<SCell> > contours;
+  if ( KSpace::dimension == 2 )
+    Surfaces<KSpace>::extractAll2DSCellContours( contours, K, SAdj, shape_set );
+  unsigned int slabs[ 5 ] = { 0, 1, 2, 7, 100 };
+  for ( unsigned int n = 0; n < 5; ++n )
+    {
+      std::vector<SCell> pbels;
+      std::vector<std::size_t> poffsets;
+      Surfaces<KSpace>::extractAllConnectedSCellParallel
+        ( pbels, poffsets, K, SAdj, shape_set, false, slabs[ n ] );
+      std::set< std::set<SCell> > pcomponents;
+      for ( std::size_t i = 0; i + 1 < poffsets.size(); ++i )
+        pcomponents.insert( std::set<SCell>( pbels.begin() + poffsets[ i ],
+                                             pbels.begin() + poffsets[ i + 1 ] ) );
+      nbok += ( pbels.size() == bels.size() 
+                && poffsets.size() == offsets.size()
+                && pcomponents == components ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "extractAllConnectedSCellParallel, " << slabs[ n ]
+                   << " slabs: " << poffsets.size() - 1 << " components"
+                   << std::endl;
+      if ( KSpace::dimension == 2 )
+        {
+          std::vector< std::vector<SCell> > pcontours;
+          Surfaces<KSpace>::extractAll2DSCellContoursParallel
+            ( pcontours, K, SAdj, shape_set, slabs[ n ] );
+          nbok += ( pcontours == contours ) ? 1 : 0;
+          nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << "extractAll2DSCellContoursParallel, " << slabs[ n ]
+                       << " slabs: " << pcontours.size() << " contours"
+                       << std::endl;
+        }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Surfaces" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<2> K2;
+  typedef KhalimskySpaceND<3> K3;
+  bool res = testDenseSurfelMarker<K2>()
+    && testDenseSurfelMarker<K3>()
+    && testDenseTracking<K2>()
+    && testDenseTracking<K3>()
+    && testExtractAllConnectedSCell<K2>()
+    && testExtractAllConnectedSCell<K3>()
+    && testParallelExtraction<K2>()
+    && testParallelExtraction<K3>();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////